@@ -0,0 +1,97 @@
+/**
+ * \file astack_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Benchmark of Stack versus AStack push/pop churn
+ *
+ * Usage: astack_bench [operations] [depth]
+ *
+ * Pushes `depth` elements and pops them all again until `operations` pushes have been made,
+ * which is the pattern a recursive-descent parser leaves on its stack.
+ */
+#include "bench.h"
+
+#include "../src/astack.h"
+#include "../src/stack.h"
+
+static void
+bench_stack(long operations, long depth, int cached)
+{
+	unsigned long sum = 0;
+	double start, elapsed;
+	Stack stack;
+	void *data;
+	long i, j;
+
+	if (cached) {
+		stack_init_cached(&stack, NULL);
+	} else {
+		stack_init(&stack, NULL);
+	}
+
+	start = bench_now();
+
+	for (i = 0; i < operations; i += depth) {
+		for (j = 0; j < depth; j++) {
+			stack_push(&stack, (void *)j);
+		}
+
+		for (j = 0; j < depth; j++) {
+			stack_pop(&stack, &data);
+			sum += (unsigned long)data;
+		}
+	}
+
+	elapsed = bench_now() - start;
+	bench_keep(sum);
+
+	printf("  Stack %-6s: %8.2f M push+pop/sec\n", cached ? "cached" : "malloc", operations / elapsed / 1e6);
+
+	stack_destroy(&stack);
+}
+
+static void
+bench_astack(long operations, long depth)
+{
+	unsigned long sum = 0;
+	double start, elapsed;
+	AStack stack;
+	void *data;
+	long i, j;
+
+	astack_init(&stack, NULL);
+
+	start = bench_now();
+
+	for (i = 0; i < operations; i += depth) {
+		for (j = 0; j < depth; j++) {
+			astack_push(&stack, (void *)j);
+		}
+
+		for (j = 0; j < depth; j++) {
+			astack_pop(&stack, &data);
+			sum += (unsigned long)data;
+		}
+	}
+
+	elapsed = bench_now() - start;
+	bench_keep(sum);
+
+	printf("  AStack      : %8.2f M push+pop/sec\n", operations / elapsed / 1e6);
+
+	astack_destroy(&stack);
+}
+
+int
+main(int argc, char **argv)
+{
+	long operations = bench_arg(argc, argv, 1, 100000000);
+	long depth = bench_arg(argc, argv, 2, 64);
+
+	printf("astack_bench: %ld operations, depth %ld\n", operations, depth);
+
+	bench_stack(operations, depth, 0);
+	bench_stack(operations, depth, 1);
+	bench_astack(operations, depth);
+
+	return 0;
+}
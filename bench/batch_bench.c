@@ -0,0 +1,178 @@
+/**
+ * \file batch_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Benchmark of single versus batch enqueue/dequeue
+ *
+ * Usage: batch_bench [messages] [batch]
+ *
+ * Moves `messages` messages through each queue in rounds of `batch`, first one call per message
+ * and then one call per round.
+ */
+#include "bench.h"
+
+#include "../src/mpmcqueue.h"
+#include "../src/queue.h"
+#include "../src/spscqueue.h"
+
+#define MAX_BATCH 4096
+
+static void *batch_in[MAX_BATCH];
+static void *batch_out[MAX_BATCH];
+
+static void
+report(const char *name, long messages, double single, double batch)
+{
+	printf("  %-10s: %8.2f M msgs/sec single, %8.2f M msgs/sec batch (%.2fx)\n", name,
+	       messages / single / 1e6, messages / batch / 1e6, single / batch);
+}
+
+static void
+bench_queue(long messages, int batch)
+{
+	unsigned long sum = 0;
+	double start, single;
+	Queue queue;
+	long i;
+	int j;
+
+	queue_init(&queue, NULL);
+
+	start = bench_now();
+
+	for (i = 0; i < messages; i += batch) {
+		for (j = 0; j < batch; j++) {
+			queue_enqueue(&queue, batch_in[j]);
+		}
+
+		for (j = 0; j < batch; j++) {
+			queue_dequeue(&queue, &batch_out[j]);
+			sum += (unsigned long)batch_out[j];
+		}
+	}
+
+	single = bench_now() - start;
+	start = bench_now();
+
+	for (i = 0; i < messages; i += batch) {
+		queue_enqueue_n(&queue, batch_in, batch);
+		queue_dequeue_n(&queue, batch_out, batch);
+
+		for (j = 0; j < batch; j++) {
+			sum += (unsigned long)batch_out[j];
+		}
+	}
+
+	report("Queue", messages, single, bench_now() - start);
+	bench_keep(sum);
+
+	queue_destroy(&queue);
+}
+
+static void
+bench_spscqueue(long messages, int batch)
+{
+	unsigned long sum = 0;
+	double start, single;
+	SPSCQueue queue;
+	long i;
+	int j;
+
+	spscqueue_init(&queue, NULL, batch);
+
+	start = bench_now();
+
+	for (i = 0; i < messages; i += batch) {
+		for (j = 0; j < batch; j++) {
+			spscqueue_enqueue(&queue, batch_in[j]);
+		}
+
+		for (j = 0; j < batch; j++) {
+			spscqueue_dequeue(&queue, &batch_out[j]);
+			sum += (unsigned long)batch_out[j];
+		}
+	}
+
+	single = bench_now() - start;
+	start = bench_now();
+
+	for (i = 0; i < messages; i += batch) {
+		spscqueue_enqueue_n(&queue, batch_in, batch);
+		spscqueue_dequeue_n(&queue, batch_out, batch);
+
+		for (j = 0; j < batch; j++) {
+			sum += (unsigned long)batch_out[j];
+		}
+	}
+
+	report("SPSCQueue", messages, single, bench_now() - start);
+	bench_keep(sum);
+
+	spscqueue_destroy(&queue);
+}
+
+static void
+bench_mpmcqueue(long messages, int batch)
+{
+	unsigned long sum = 0;
+	double start, single;
+	MPMCQueue queue;
+	long i;
+	int j;
+
+	mpmcqueue_init(&queue, NULL, batch);
+
+	start = bench_now();
+
+	for (i = 0; i < messages; i += batch) {
+		for (j = 0; j < batch; j++) {
+			mpmcqueue_try_enqueue(&queue, batch_in[j]);
+		}
+
+		for (j = 0; j < batch; j++) {
+			mpmcqueue_try_dequeue(&queue, &batch_out[j]);
+			sum += (unsigned long)batch_out[j];
+		}
+	}
+
+	single = bench_now() - start;
+	start = bench_now();
+
+	for (i = 0; i < messages; i += batch) {
+		mpmcqueue_try_enqueue_n(&queue, batch_in, batch);
+		mpmcqueue_try_dequeue_n(&queue, batch_out, batch);
+
+		for (j = 0; j < batch; j++) {
+			sum += (unsigned long)batch_out[j];
+		}
+	}
+
+	report("MPMCQueue", messages, single, bench_now() - start);
+	bench_keep(sum);
+
+	mpmcqueue_destroy(&queue);
+}
+
+int
+main(int argc, char **argv)
+{
+	long messages = bench_arg(argc, argv, 1, 20000000);
+	long batch = bench_arg(argc, argv, 2, 32);
+	long i;
+
+	if (batch < 1 || batch > MAX_BATCH) {
+		fprintf(stderr, "batch must be between 1 and %d\n", MAX_BATCH);
+		return 1;
+	}
+
+	for (i = 0; i < batch; i++) {
+		batch_in[i] = (void *)(i + 1);
+	}
+
+	printf("batch_bench: %ld messages, batch %ld\n", messages, batch);
+
+	bench_queue(messages, (int)batch);
+	bench_spscqueue(messages, (int)batch);
+	bench_mpmcqueue(messages, (int)batch);
+
+	return 0;
+}
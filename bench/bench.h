@@ -0,0 +1,40 @@
+/**
+ * \file bench.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Helpers shared by the benchmark programs
+ */
+#ifndef BENCH_h
+#define BENCH_h
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * \brief Function returning a monotonic timestamp in seconds
+ */
+static inline double
+bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**
+ * \brief Function returning the integer given as `argv[index]`, or `fallback` if absent
+ */
+static inline long
+bench_arg(int argc, char **argv, int index, long fallback)
+{
+	return argc > index ? strtol(argv[index], NULL, 10) : fallback;
+}
+
+/**
+ * MACRO that keeps the compiler from optimizing away a computed value
+ */
+#define bench_keep(value) __asm__ __volatile__("" : : "g"(value) : "memory")
+
+#endif // BENCH_h
@@ -0,0 +1,141 @@
+/**
+ * \file bqueue_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Benchmark of an idle consumer sleep-polling a Queue versus waiting on a BQueue
+ *
+ * Usage: bqueue_bench [messages] [interval_us] [poll_us]
+ *
+ * A producer sends `messages` messages `interval_us` apart, stamped with their send time. The
+ * consumer either polls a mutex-guarded Queue, sleeping `poll_us` whenever it is empty, or
+ * blocks in *bqueue_dequeue*. Reports the mean delay from send to receipt and the CPU time the
+ * consumer burned.
+ */
+#include "bench.h"
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include "../src/bqueue.h"
+#include "../src/queue.h"
+
+typedef struct Shared_s {
+	int blocking;
+	long messages;
+	long interval_us;
+	long poll_us;
+
+	pthread_mutex_t mutex;
+	Queue queue;
+	BQueue bqueue;
+
+	double stamps[2];
+	double delay;
+	double cpu;
+
+} Shared;
+
+static double
+thread_cpu(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void *
+consumer_run(void *arg)
+{
+	Shared *shared = (Shared *)arg;
+	double cpu = thread_cpu();
+	double *stamp;
+	void *data;
+	int received;
+	long i;
+
+	shared->delay = 0;
+
+	for (i = 0; i < shared->messages; i++) {
+		if (shared->blocking) {
+			bqueue_dequeue(&shared->bqueue, &data);
+		} else {
+			do {
+				pthread_mutex_lock(&shared->mutex);
+				received = queue_dequeue(&shared->queue, &data) == 0;
+				pthread_mutex_unlock(&shared->mutex);
+
+				if (!received) {
+					usleep(shared->poll_us);
+				}
+			} while (!received);
+		}
+
+		stamp = (double *)data;
+		shared->delay += bench_now() - *stamp;
+	}
+
+	shared->cpu = thread_cpu() - cpu;
+
+	return NULL;
+}
+
+static void
+run(int blocking, long messages, long interval_us, long poll_us)
+{
+	pthread_t consumer;
+	Shared shared;
+	double *stamp;
+	long i;
+
+	shared.blocking = blocking;
+	shared.messages = messages;
+	shared.interval_us = interval_us;
+	shared.poll_us = poll_us;
+	pthread_mutex_init(&shared.mutex, NULL);
+	queue_init(&shared.queue, NULL);
+	bqueue_init(&shared.bqueue, NULL, 0);
+
+	pthread_create(&consumer, NULL, consumer_run, &shared);
+
+	for (i = 0; i < messages; i++) {
+		usleep(interval_us);
+
+		// Alternate between two stamps; the consumer is done with a message long before the next
+		stamp = &shared.stamps[i % 2];
+		*stamp = bench_now();
+
+		if (blocking) {
+			bqueue_enqueue(&shared.bqueue, stamp);
+		} else {
+			pthread_mutex_lock(&shared.mutex);
+			queue_enqueue(&shared.queue, stamp);
+			pthread_mutex_unlock(&shared.mutex);
+		}
+	}
+
+	pthread_join(consumer, NULL);
+
+	printf("  %-16s: %8.1f us mean wake-up delay, %7.1f ms consumer CPU\n",
+	       blocking ? "BQueue" : "Queue + usleep", shared.delay * 1e6 / messages, shared.cpu * 1e3);
+
+	pthread_mutex_destroy(&shared.mutex);
+	queue_destroy(&shared.queue);
+	bqueue_destroy(&shared.bqueue);
+}
+
+int
+main(int argc, char **argv)
+{
+	long messages = bench_arg(argc, argv, 1, 2000);
+	long interval_us = bench_arg(argc, argv, 2, 500);
+	long poll_us = bench_arg(argc, argv, 3, 50);
+
+	printf("bqueue_bench: %ld messages every %ld us, polling every %ld us\n", messages, interval_us,
+	       poll_us);
+
+	run(0, messages, interval_us, poll_us);
+	run(1, messages, interval_us, poll_us);
+
+	return 0;
+}
@@ -0,0 +1,110 @@
+/**
+ * \file cstack_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Benchmark of a shared free list as a mutex-guarded Stack versus CStack
+ *
+ * Usage: cstack_bench [operations_per_thread] [max_threads]
+ *
+ * Each thread repeatedly takes a buffer from the shared free list and puts it back, the way a
+ * buffer pool is used.
+ */
+#include "bench.h"
+
+#include <pthread.h>
+
+#include "../src/cstack.h"
+#include "../src/stack.h"
+
+typedef struct Shared_s {
+	int locked;
+	long operations;
+
+	pthread_mutex_t mutex;
+	Stack stack;
+	CStack cstack;
+
+} Shared;
+
+static void *
+worker_run(void *arg)
+{
+	Shared *shared = (Shared *)arg;
+	void *buffer;
+	long i;
+
+	for (i = 0; i < shared->operations; i++) {
+		if (shared->locked) {
+			pthread_mutex_lock(&shared->mutex);
+			stack_pop(&shared->stack, &buffer);
+			pthread_mutex_unlock(&shared->mutex);
+
+			bench_keep(buffer);
+
+			pthread_mutex_lock(&shared->mutex);
+			stack_push(&shared->stack, buffer);
+			pthread_mutex_unlock(&shared->mutex);
+		} else {
+			cstack_pop(&shared->cstack, &buffer);
+			bench_keep(buffer);
+			cstack_push(&shared->cstack, buffer);
+		}
+	}
+
+	return NULL;
+}
+
+static double
+run(int locked, long operations, long threads)
+{
+	pthread_t tid[threads];
+	double start, elapsed;
+	Shared shared;
+	long i;
+
+	shared.locked = locked;
+	shared.operations = operations;
+	pthread_mutex_init(&shared.mutex, NULL);
+	stack_init(&shared.stack, NULL);
+	cstack_init(&shared.cstack, NULL);
+
+	// One buffer per thread and then some, so a pop never finds the list empty
+	for (i = 0; i < 2 * threads; i++) {
+		stack_push(&shared.stack, (void *)(i + 1));
+		cstack_push(&shared.cstack, (void *)(i + 1));
+	}
+
+	start = bench_now();
+
+	for (i = 0; i < threads; i++) {
+		pthread_create(&tid[i], NULL, worker_run, &shared);
+	}
+
+	for (i = 0; i < threads; i++) {
+		pthread_join(tid[i], NULL);
+	}
+
+	elapsed = bench_now() - start;
+
+	pthread_mutex_destroy(&shared.mutex);
+	stack_destroy(&shared.stack);
+	cstack_destroy(&shared.cstack);
+
+	return operations * threads / elapsed;
+}
+
+int
+main(int argc, char **argv)
+{
+	long operations = bench_arg(argc, argv, 1, 5000000);
+	long max_threads = bench_arg(argc, argv, 2, 4);
+	long threads;
+
+	printf("cstack_bench: %ld pop+push per thread\n", operations);
+
+	for (threads = 1; threads <= max_threads; threads *= 2) {
+		printf("  %2ld threads: mutex+Stack %8.2f M ops/sec, CStack %8.2f M ops/sec\n", threads,
+		       run(1, operations, threads) / 1e6, run(0, operations, threads) / 1e6);
+	}
+
+	return 0;
+}
@@ -0,0 +1,103 @@
+/**
+ * \file dlist_hugepage_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Benchmark of DList traversal with malloc'd versus huge page arena elements
+ *
+ * Elements are linked in a random order relative to the order they were allocated in, as they
+ * are in long-lived lists, so each *dlist_next* lands on an unpredictable page.
+ *
+ * Usage: dlist_hugepage_bench [size] [passes]
+ */
+#include "bench.h"
+
+#include "../src/dlist.h"
+
+static unsigned long long rng = 88172645463325252ULL;
+
+static unsigned long long
+xorshift(void)
+{
+	rng ^= rng << 13;
+	rng ^= rng >> 7;
+	rng ^= rng << 17;
+
+	return rng;
+}
+
+static void
+build(DList *list, long size)
+{
+	DList_Element **elements = malloc(sizeof (DList_Element *) * size);
+	DList_Element *after;
+	long i;
+
+	// Insert each element after a random earlier one to scatter the logical order
+	dlist_insert_next(list, NULL, (void *)0);
+	elements[0] = dlist_head(list);
+
+	for (i = 1; i < size; i++) {
+		after = elements[xorshift() % i];
+		dlist_insert_next(list, after, (void *)i);
+		elements[i] = dlist_next(after);
+	}
+
+	free(elements);
+}
+
+static double
+traverse(DList *list, long passes)
+{
+	DList_Element *element;
+	unsigned long sum = 0;
+	double start;
+	long pass;
+
+	start = bench_now();
+
+	for (pass = 0; pass < passes; pass++) {
+		for (element = dlist_head(list); element != NULL; element = dlist_next(element)) {
+			sum += (unsigned long)dlist_data(element);
+		}
+	}
+
+	bench_keep(sum);
+
+	return (bench_now() - start) * 1e9 / ((double)dlist_size(list) * passes);
+}
+
+int
+main(int argc, char **argv)
+{
+	long size = bench_arg(argc, argv, 1, 10000000);
+	long passes = bench_arg(argc, argv, 2, 3);
+	char thp[64] = "unknown";
+	FILE *file;
+	DList list;
+
+	if ((file = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r")) != NULL) {
+		if (fgets(thp, sizeof (thp), file) == NULL) {
+			thp[0] = '\0';
+		}
+
+		fclose(file);
+	}
+
+	printf("dlist_hugepage_bench: %ld elements, %ld passes, THP: %s", size, passes, thp);
+
+	dlist_init(&list, NULL);
+	build(&list, size);
+	printf("  malloc   : %8.2f ns/element\n", traverse(&list, passes));
+	dlist_destroy(&list);
+
+	dlist_init_arena(&list, NULL, 0);
+	build(&list, size);
+	printf("  arena    : %8.2f ns/element\n", traverse(&list, passes));
+	dlist_destroy(&list);
+
+	dlist_init_hugepage(&list, NULL);
+	build(&list, size);
+	printf("  hugepage : %8.2f ns/element\n", traverse(&list, passes));
+	dlist_destroy(&list);
+
+	return 0;
+}
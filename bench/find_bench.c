@@ -0,0 +1,92 @@
+/**
+ * \file find_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Benchmark of list_find versus a naive search loop
+ *
+ * Usage: find_bench [elements] [searches]
+ *
+ * Builds a List of `elements` elements whose link order is shuffled relative to their order in
+ * memory, then searches it `searches` times for a key that is not there, once with a plain loop
+ * and once with *list_find*.
+ */
+#include "bench.h"
+
+#include "../src/list.h"
+
+typedef struct Record_s {
+	int value;
+	int shuffle;
+
+} Record;
+
+static int
+match_value(const void *key, const void *data)
+{
+	return *(const int *)key == ((const Record *)data)->value;
+}
+
+static int
+compare_shuffle(const void *key1, const void *key2)
+{
+	return ((const Record *)key1)->shuffle - ((const Record *)key2)->shuffle;
+}
+
+int
+main(int argc, char **argv)
+{
+	long elements = bench_arg(argc, argv, 1, 1000000);
+	long searches = bench_arg(argc, argv, 2, 20);
+	double start, naive, library;
+	List_Element *element, *found = NULL;
+	Record *records;
+	int missing = -1;
+	List list;
+	long i;
+
+	printf("find_bench: %ld elements, %ld searches\n", elements, searches);
+
+	records = (Record *)malloc(elements * sizeof (Record));
+	list_init(&list, NULL);
+	list_set_match(&list, match_value);
+	srand(1);
+
+	for (i = 0; i < elements; i++) {
+		records[i].value = (int)i;
+		records[i].shuffle = rand();
+		list_insert_next(&list, list_tail(&list), &records[i]);
+	}
+
+	// Scatter the link order so each step lands somewhere new in memory
+	list_sort(&list, compare_shuffle);
+
+	start = bench_now();
+
+	for (i = 0; i < searches; i++) {
+		for (element = list_head(&list); element != NULL; element = list_next(element)) {
+			if (list.match(&missing, list_data(element))) {
+				break;
+			}
+		}
+
+		bench_keep(element);
+	}
+
+	naive = bench_now() - start;
+	start = bench_now();
+
+	for (i = 0; i < searches; i++) {
+		found = list_find(&list, &missing);
+		bench_keep(found);
+	}
+
+	library = bench_now() - start;
+
+	printf("  naive loop : %8.2f ns/element\n", naive / (searches * elements) * 1e9);
+	printf("  list_find  : %8.2f ns/element (%.2fx)\n", library / (searches * elements) * 1e9,
+	       naive / library);
+
+	list_destroy(&list);
+	free(records);
+
+	return 0;
+}
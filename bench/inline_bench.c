@@ -0,0 +1,95 @@
+/**
+ * \file inline_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Benchmark of a small-record Queue with heap-allocated versus inline values
+ *
+ * Usage: inline_bench [operations] [depth]
+ */
+#include "bench.h"
+
+#include "../src/queue.h"
+
+typedef struct Record_s {
+	long id;
+	double value;
+
+} Record;
+
+static double
+churn_pointer(long operations, long depth)
+{
+	Queue queue;
+	Record *record;
+	void *data;
+	double sum = 0.0, start;
+	long i;
+
+	queue_init(&queue, free);
+
+	start = bench_now();
+
+	// Each message is a heap-allocated record plus a list element
+	for (i = 0; i < operations + depth; i++) {
+		record = malloc(sizeof (Record));
+		record->id = i;
+		record->value = (double)i;
+		queue_enqueue(&queue, record);
+
+		if (i >= depth) {
+			queue_dequeue(&queue, &data);
+			sum += ((Record *)data)->value;
+			free(data);
+		}
+	}
+
+	start = bench_now() - start;
+	bench_keep(sum);
+	queue_destroy(&queue);
+
+	return (double)operations / start;
+}
+
+static double
+churn_inline(long operations, long depth)
+{
+	Queue queue;
+	Record record, out;
+	void *data = &out;
+	double sum = 0.0, start;
+	long i;
+
+	queue_init_inline(&queue, NULL, sizeof (Record), NULL);
+
+	start = bench_now();
+
+	// Each message is copied into its list element
+	for (i = 0; i < operations + depth; i++) {
+		record.id = i;
+		record.value = (double)i;
+		queue_enqueue(&queue, &record);
+
+		if (i >= depth) {
+			queue_dequeue(&queue, &data);
+			sum += out.value;
+		}
+	}
+
+	start = bench_now() - start;
+	bench_keep(sum);
+	queue_destroy(&queue);
+
+	return (double)operations / start;
+}
+
+int
+main(int argc, char **argv)
+{
+	long operations = bench_arg(argc, argv, 1, 10000000);
+	long depth = bench_arg(argc, argv, 2, 1000);
+
+	printf("inline_bench: %ld 16-byte records through a queue %ld deep\n", operations, depth);
+	printf("  pointer : %12.0f msgs/sec\n", churn_pointer(operations, depth));
+	printf("  inline  : %12.0f msgs/sec\n", churn_inline(operations, depth));
+
+	return 0;
+}
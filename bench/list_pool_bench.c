@@ -0,0 +1,89 @@
+/**
+ * \file list_pool_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Benchmark of Stack and Queue churn with malloc'd versus pooled list elements
+ *
+ * Usage: list_pool_bench [operations] [depth]
+ */
+#include "bench.h"
+
+#include "../src/pool.h"
+#include "../src/queue.h"
+#include "../src/stack.h"
+
+static double
+stack_churn(Stack *stack, long operations, long depth)
+{
+	void *data;
+	double start;
+	long i;
+
+	// Keep `depth` items resident so the list is not trivially empty
+	for (i = 0; i < depth; i++) {
+		stack_push(stack, &i);
+	}
+
+	start = bench_now();
+
+	for (i = 0; i < operations; i++) {
+		stack_push(stack, &i);
+		stack_pop(stack, &data);
+	}
+
+	return (double)operations / (bench_now() - start);
+}
+
+static double
+queue_churn(Queue *queue, long operations, long depth)
+{
+	void *data;
+	double start;
+	long i;
+
+	for (i = 0; i < depth; i++) {
+		queue_enqueue(queue, &i);
+	}
+
+	start = bench_now();
+
+	for (i = 0; i < operations; i++) {
+		queue_enqueue(queue, &i);
+		queue_dequeue(queue, &data);
+	}
+
+	return (double)operations / (bench_now() - start);
+}
+
+int
+main(int argc, char **argv)
+{
+	long operations = bench_arg(argc, argv, 1, 10000000);
+	long depth = bench_arg(argc, argv, 2, 1000);
+	Stack stack;
+	Queue queue;
+	Pool pool;
+
+	printf("list_pool_bench: %ld push/pop pairs, %ld resident items\n", operations, depth);
+
+	stack_init(&stack, NULL);
+	printf("  stack malloc : %12.0f ops/sec\n", stack_churn(&stack, operations, depth));
+	stack_destroy(&stack);
+
+	pool_init(&pool, sizeof (List_Element), 0);
+	stack_init_pool(&stack, NULL, &pool);
+	printf("  stack pool   : %12.0f ops/sec\n", stack_churn(&stack, operations, depth));
+	stack_destroy(&stack);
+	pool_destroy(&pool);
+
+	queue_init(&queue, NULL);
+	printf("  queue malloc : %12.0f ops/sec\n", queue_churn(&queue, operations, depth));
+	queue_destroy(&queue);
+
+	pool_init(&pool, sizeof (List_Element), 0);
+	queue_init_pool(&queue, NULL, &pool);
+	printf("  queue pool   : %12.0f ops/sec\n", queue_churn(&queue, operations, depth));
+	queue_destroy(&queue);
+	pool_destroy(&pool);
+
+	return 0;
+}
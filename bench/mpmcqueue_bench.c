@@ -0,0 +1,145 @@
+/**
+ * \file mpmcqueue_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Benchmark of mutex-guarded Queue versus MPMCQueue with 1 to N producers and consumers
+ *
+ * Usage: mpmcqueue_bench [messages] [max_threads] [capacity]
+ *
+ * For each thread count t from 1 to `max_threads`, t producers and t consumers pass `messages`
+ * messages in total through one shared queue.
+ */
+#include "bench.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "../src/mpmcqueue.h"
+#include "../src/queue.h"
+
+typedef struct Shared_s {
+	int locked;
+	long per_thread;
+	long capacity;
+
+	pthread_mutex_t mutex;
+	Queue queue;
+	MPMCQueue mpmc_queue;
+
+} Shared;
+
+static void *
+producer_run(void *arg)
+{
+	Shared *shared = (Shared *)arg;
+	int sent;
+	long i;
+
+	for (i = 0; i < shared->per_thread; i++) {
+		if (!shared->locked) {
+			mpmcqueue_enqueue(&shared->mpmc_queue, (void *)i);
+			continue;
+		}
+
+		do {
+			pthread_mutex_lock(&shared->mutex);
+			sent = queue_size(&shared->queue) < shared->capacity &&
+			       queue_enqueue(&shared->queue, (void *)i) == 0;
+			pthread_mutex_unlock(&shared->mutex);
+
+			if (!sent) {
+				sched_yield();
+			}
+		} while (!sent);
+	}
+
+	return NULL;
+}
+
+static void *
+consumer_run(void *arg)
+{
+	Shared *shared = (Shared *)arg;
+	unsigned long sum = 0;
+	int received;
+	void *data;
+	long i;
+
+	for (i = 0; i < shared->per_thread; i++) {
+		if (!shared->locked) {
+			mpmcqueue_dequeue(&shared->mpmc_queue, &data);
+			sum += (unsigned long)data;
+			continue;
+		}
+
+		do {
+			pthread_mutex_lock(&shared->mutex);
+			received = queue_dequeue(&shared->queue, &data) == 0;
+			pthread_mutex_unlock(&shared->mutex);
+
+			if (!received) {
+				sched_yield();
+			}
+		} while (!received);
+
+		sum += (unsigned long)data;
+	}
+
+	bench_keep(sum);
+
+	return NULL;
+}
+
+static double
+run(int locked, long messages, long threads, long capacity)
+{
+	pthread_t producers[threads], consumers[threads];
+	double start, elapsed;
+	Shared shared;
+	long i;
+
+	shared.locked = locked;
+	shared.per_thread = messages / threads;
+	shared.capacity = capacity;
+	pthread_mutex_init(&shared.mutex, NULL);
+	queue_init(&shared.queue, NULL);
+	mpmcqueue_init(&shared.mpmc_queue, NULL, capacity);
+
+	start = bench_now();
+
+	for (i = 0; i < threads; i++) {
+		pthread_create(&consumers[i], NULL, consumer_run, &shared);
+		pthread_create(&producers[i], NULL, producer_run, &shared);
+	}
+
+	for (i = 0; i < threads; i++) {
+		pthread_join(producers[i], NULL);
+		pthread_join(consumers[i], NULL);
+	}
+
+	elapsed = bench_now() - start;
+
+	pthread_mutex_destroy(&shared.mutex);
+	queue_destroy(&shared.queue);
+	mpmcqueue_destroy(&shared.mpmc_queue);
+
+	return shared.per_thread * threads / elapsed;
+}
+
+int
+main(int argc, char **argv)
+{
+	long messages = bench_arg(argc, argv, 1, 10000000);
+	long max_threads = bench_arg(argc, argv, 2, 4);
+	long capacity = bench_arg(argc, argv, 3, 1024);
+	long threads;
+
+	printf("mpmcqueue_bench: %ld messages, capacity %ld\n", messages, capacity);
+
+	for (threads = 1; threads <= max_threads; threads++) {
+		printf("  %ldP/%ldC: mutex+Queue %8.2f M msgs/sec, MPMCQueue %8.2f M msgs/sec\n", threads,
+		       threads, run(1, messages, threads, capacity) / 1e6,
+		       run(0, messages, threads, capacity) / 1e6);
+	}
+
+	return 0;
+}
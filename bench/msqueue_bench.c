@@ -0,0 +1,131 @@
+/**
+ * \file msqueue_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Benchmark of mutex-guarded Queue versus MSQueue under contention
+ *
+ * Usage: msqueue_bench [messages] [max_threads]
+ *
+ * For each thread count t from 1 to `max_threads`, t producers and t consumers pass `messages`
+ * messages in total through one shared queue. Consumers yield the processor when the queue is
+ * empty.
+ */
+#include "bench.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "../src/msqueue.h"
+#include "../src/queue.h"
+
+typedef struct Shared_s {
+	int locked;
+	long per_thread;
+
+	pthread_mutex_t mutex;
+	Queue queue;
+	MSQueue ms_queue;
+
+} Shared;
+
+static void *
+producer_run(void *arg)
+{
+	Shared *shared = (Shared *)arg;
+	long i;
+
+	for (i = 0; i < shared->per_thread; i++) {
+		if (shared->locked) {
+			pthread_mutex_lock(&shared->mutex);
+			queue_enqueue(&shared->queue, (void *)i);
+			pthread_mutex_unlock(&shared->mutex);
+		} else {
+			msqueue_enqueue(&shared->ms_queue, (void *)i);
+		}
+	}
+
+	return NULL;
+}
+
+static void *
+consumer_run(void *arg)
+{
+	Shared *shared = (Shared *)arg;
+	unsigned long sum = 0;
+	int received;
+	void *data;
+	long i;
+
+	for (i = 0; i < shared->per_thread; i++) {
+		do {
+			if (shared->locked) {
+				pthread_mutex_lock(&shared->mutex);
+				received = queue_dequeue(&shared->queue, &data) == 0;
+				pthread_mutex_unlock(&shared->mutex);
+			} else {
+				received = msqueue_dequeue(&shared->ms_queue, &data) == 0;
+			}
+
+			if (!received) {
+				sched_yield();
+			}
+		} while (!received);
+
+		sum += (unsigned long)data;
+	}
+
+	bench_keep(sum);
+
+	return NULL;
+}
+
+static double
+run(int locked, long messages, long threads)
+{
+	pthread_t producers[threads], consumers[threads];
+	double start, elapsed;
+	Shared shared;
+	long i;
+
+	shared.locked = locked;
+	shared.per_thread = messages / threads;
+	pthread_mutex_init(&shared.mutex, NULL);
+	queue_init(&shared.queue, NULL);
+	msqueue_init(&shared.ms_queue, NULL);
+
+	start = bench_now();
+
+	for (i = 0; i < threads; i++) {
+		pthread_create(&consumers[i], NULL, consumer_run, &shared);
+		pthread_create(&producers[i], NULL, producer_run, &shared);
+	}
+
+	for (i = 0; i < threads; i++) {
+		pthread_join(producers[i], NULL);
+		pthread_join(consumers[i], NULL);
+	}
+
+	elapsed = bench_now() - start;
+
+	pthread_mutex_destroy(&shared.mutex);
+	queue_destroy(&shared.queue);
+	msqueue_destroy(&shared.ms_queue);
+
+	return shared.per_thread * threads / elapsed;
+}
+
+int
+main(int argc, char **argv)
+{
+	long messages = bench_arg(argc, argv, 1, 10000000);
+	long max_threads = bench_arg(argc, argv, 2, 4);
+	long threads;
+
+	printf("msqueue_bench: %ld messages\n", messages);
+
+	for (threads = 1; threads <= max_threads; threads++) {
+		printf("  %ldP/%ldC: mutex+Queue %8.2f M msgs/sec, MSQueue %8.2f M msgs/sec\n", threads,
+		       threads, run(1, messages, threads) / 1e6, run(0, messages, threads) / 1e6);
+	}
+
+	return 0;
+}
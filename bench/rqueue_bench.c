@@ -0,0 +1,90 @@
+/**
+ * \file rqueue_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Benchmark of Queue versus RQueue message throughput
+ *
+ * Usage: rqueue_bench [messages] [backlog]
+ *
+ * Keeps `backlog` messages in flight, enqueuing one and dequeuing one until `messages` have
+ * passed through the queue.
+ */
+#include "bench.h"
+
+#include "../src/queue.h"
+#include "../src/rqueue.h"
+
+static void
+bench_queue(long messages, long backlog)
+{
+	unsigned long sum = 0;
+	double start, elapsed;
+	Queue queue;
+	void *data;
+	long i;
+
+	queue_init(&queue, NULL);
+
+	for (i = 0; i < backlog; i++) {
+		queue_enqueue(&queue, (void *)i);
+	}
+
+	start = bench_now();
+
+	for (i = 0; i < messages; i++) {
+		queue_enqueue(&queue, (void *)i);
+		queue_dequeue(&queue, &data);
+		sum += (unsigned long)data;
+	}
+
+	elapsed = bench_now() - start;
+	bench_keep(sum);
+
+	printf("  Queue  : %8.2f M msgs/sec\n", messages / elapsed / 1e6);
+
+	queue_destroy(&queue);
+}
+
+static void
+bench_rqueue(long messages, long backlog)
+{
+	unsigned long sum = 0;
+	double start, elapsed;
+	RQueue queue;
+	void *data;
+	long i;
+
+	rqueue_init(&queue, NULL);
+
+	for (i = 0; i < backlog; i++) {
+		rqueue_enqueue(&queue, (void *)i);
+	}
+
+	start = bench_now();
+
+	for (i = 0; i < messages; i++) {
+		rqueue_enqueue(&queue, (void *)i);
+		rqueue_dequeue(&queue, &data);
+		sum += (unsigned long)data;
+	}
+
+	elapsed = bench_now() - start;
+	bench_keep(sum);
+
+	printf("  RQueue : %8.2f M msgs/sec\n", messages / elapsed / 1e6);
+
+	rqueue_destroy(&queue);
+}
+
+int
+main(int argc, char **argv)
+{
+	long messages = bench_arg(argc, argv, 1, 50000000);
+	long backlog = bench_arg(argc, argv, 2, 1000);
+
+	printf("rqueue_bench: %ld messages, backlog %ld\n", messages, backlog);
+
+	bench_queue(messages, backlog);
+	bench_rqueue(messages, backlog);
+
+	return 0;
+}
@@ -0,0 +1,84 @@
+/**
+ * \file skipindex_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Benchmark of lookups in a sorted DList with and without a skip-list index
+ *
+ * Usage: skipindex_bench [elements] [lookups]
+ *
+ * Builds a sorted DList of `elements` keys, then looks up `lookups` random keys, once by walking
+ * from the head and once through a SkipIndex. A linear walk costs O(n) per lookup, so it is run
+ * for a thousandth of the lookups and reported per lookup.
+ */
+#include "bench.h"
+
+#include "../src/skipindex.h"
+
+static int
+compare_keys(const void *key1, const void *key2)
+{
+	long a = (long)key1, b = (long)key2;
+
+	return (a > b) - (a < b);
+}
+
+int
+main(int argc, char **argv)
+{
+	long elements = bench_arg(argc, argv, 1, 1000000);
+	long lookups = bench_arg(argc, argv, 2, 1000000);
+	long walks = lookups / 1000 > 0 ? lookups / 1000 : 1;
+	double start, built, walked, indexed;
+	DList_Element *element;
+	SkipIndex index;
+	DList list;
+	long i, key;
+
+	printf("skipindex_bench: %ld elements, %ld lookups\n", elements, lookups);
+
+	// Odd keys only, so half of the lookups miss
+	dlist_init(&list, NULL);
+
+	for (i = 0; i < elements; i++) {
+		dlist_insert_next(&list, dlist_tail(&list), (void *)(2 * i + 1));
+	}
+
+	srand(1);
+	start = bench_now();
+
+	for (i = 0; i < walks; i++) {
+		key = rand() % (2 * elements);
+
+		for (element = dlist_head(&list); element != NULL; element = dlist_next(element)) {
+			if (compare_keys(dlist_data(element), (void *)key) >= 0) {
+				break;
+			}
+		}
+
+		bench_keep(element);
+	}
+
+	walked = (bench_now() - start) / walks;
+
+	start = bench_now();
+	skipindex_init(&index, &list, compare_keys);
+	built = bench_now() - start;
+
+	srand(1);
+	start = bench_now();
+
+	for (i = 0; i < lookups; i++) {
+		key = rand() % (2 * elements);
+		bench_keep(skipindex_lower_bound(&index, (void *)key));
+	}
+
+	indexed = (bench_now() - start) / lookups;
+
+	printf("  linear walk : %12.1f ns/lookup\n", walked * 1e9);
+	printf("  skipindex   : %12.1f ns/lookup (%.0fx), index built in %.3f sec\n", indexed * 1e9,
+	       walked / indexed, built);
+
+	skipindex_destroy(&index);
+	dlist_destroy(&list);
+
+	return 0;
+}
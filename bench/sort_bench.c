@@ -0,0 +1,153 @@
+/**
+ * \file sort_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Benchmark of list_sort/dlist_sort versus sorting through an array with qsort
+ *
+ * Usage: sort_bench [elements]
+ *
+ * Sorts `elements` random keys held in a List and in a DList, once by draining the list into an
+ * array, calling *qsort* and rebuilding the list, and once in place.
+ */
+#include "bench.h"
+
+#include "../src/dlist.h"
+#include "../src/list.h"
+
+static int
+compare_keys(const void *key1, const void *key2)
+{
+	long a = (long)key1, b = (long)key2;
+
+	return (a > b) - (a < b);
+}
+
+static int
+compare_slots(const void *slot1, const void *slot2)
+{
+	return compare_keys(*(void *const *)slot1, *(void *const *)slot2);
+}
+
+static void
+fill_list(List *list, long elements)
+{
+	long i;
+
+	srand(1);
+
+	for (i = 0; i < elements; i++) {
+		list_insert_next(list, list_tail(list), (void *)(long)rand());
+	}
+}
+
+static void
+fill_dlist(DList *list, long elements)
+{
+	long i;
+
+	srand(1);
+
+	for (i = 0; i < elements; i++) {
+		dlist_insert_next(list, dlist_tail(list), (void *)(long)rand());
+	}
+}
+
+static void
+bench_list(long elements)
+{
+	double start, array, in_place;
+	void **slots;
+	List list;
+	long i;
+
+	// Round trip through an array
+	list_init(&list, NULL);
+	fill_list(&list, elements);
+
+	start = bench_now();
+	slots = (void **)malloc(elements * sizeof (void *));
+
+	for (i = 0; i < elements; i++) {
+		list_remove_next(&list, NULL, &slots[i]);
+	}
+
+	qsort(slots, elements, sizeof (void *), compare_slots);
+
+	for (i = 0; i < elements; i++) {
+		list_insert_next(&list, list_tail(&list), slots[i]);
+	}
+
+	free(slots);
+	array = bench_now() - start;
+	bench_keep(list_head(&list));
+	list_destroy(&list);
+
+	// Relinking in place
+	list_init(&list, NULL);
+	fill_list(&list, elements);
+
+	start = bench_now();
+	list_sort(&list, compare_keys);
+	in_place = bench_now() - start;
+	bench_keep(list_head(&list));
+	list_destroy(&list);
+
+	printf("  List  : array+qsort %8.3f sec, list_sort  %8.3f sec (%.2fx)\n", array, in_place,
+	       array / in_place);
+}
+
+static void
+bench_dlist(long elements)
+{
+	double start, array, in_place;
+	void **slots;
+	DList list;
+	long i;
+
+	// Round trip through an array
+	dlist_init(&list, NULL);
+	fill_dlist(&list, elements);
+
+	start = bench_now();
+	slots = (void **)malloc(elements * sizeof (void *));
+
+	for (i = 0; i < elements; i++) {
+		dlist_remove(&list, dlist_head(&list), &slots[i]);
+	}
+
+	qsort(slots, elements, sizeof (void *), compare_slots);
+
+	for (i = 0; i < elements; i++) {
+		dlist_insert_next(&list, dlist_tail(&list), slots[i]);
+	}
+
+	free(slots);
+	array = bench_now() - start;
+	bench_keep(dlist_head(&list));
+	dlist_destroy(&list);
+
+	// Relinking in place
+	dlist_init(&list, NULL);
+	fill_dlist(&list, elements);
+
+	start = bench_now();
+	dlist_sort(&list, compare_keys);
+	in_place = bench_now() - start;
+	bench_keep(dlist_head(&list));
+	dlist_destroy(&list);
+
+	printf("  DList : array+qsort %8.3f sec, dlist_sort %8.3f sec (%.2fx)\n", array, in_place,
+	       array / in_place);
+}
+
+int
+main(int argc, char **argv)
+{
+	long elements = bench_arg(argc, argv, 1, 1000000);
+
+	printf("sort_bench: %ld elements\n", elements);
+
+	bench_list(elements);
+	bench_dlist(elements);
+
+	return 0;
+}
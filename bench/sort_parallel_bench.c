@@ -0,0 +1,80 @@
+/**
+ * \file sort_parallel_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Benchmark of dlist_sort_parallel with 1 to N threads
+ *
+ * Usage: sort_parallel_bench [elements] [max_threads]
+ *
+ * Sorts `elements` random keys held in a DList with *dlist_sort*, then with *dlist_sort_parallel*
+ * for each thread count from 2 to `max_threads`.
+ */
+#include "bench.h"
+
+#include "../src/dlist.h"
+
+static int
+compare_keys(const void *key1, const void *key2)
+{
+	long a = (long)key1, b = (long)key2;
+
+	return (a > b) - (a < b);
+}
+
+static void
+fill(DList *list, long elements)
+{
+	long i;
+
+	srand(1);
+
+	for (i = 0; i < elements; i++) {
+		dlist_insert_next(list, dlist_tail(list), (void *)(long)rand());
+	}
+}
+
+static double
+bench_sort(long elements, int threads)
+{
+	double start, elapsed;
+	DList list;
+
+	dlist_init(&list, NULL);
+	fill(&list, elements);
+
+	start = bench_now();
+
+	if (threads == 1) {
+		dlist_sort(&list, compare_keys);
+	} else {
+		dlist_sort_parallel(&list, compare_keys, threads);
+	}
+
+	elapsed = bench_now() - start;
+	bench_keep(dlist_head(&list));
+
+	dlist_destroy(&list);
+
+	return elapsed;
+}
+
+int
+main(int argc, char **argv)
+{
+	long elements = bench_arg(argc, argv, 1, 4000000);
+	int max_threads = (int)bench_arg(argc, argv, 2, 4);
+	double serial, elapsed;
+	int threads;
+
+	printf("sort_parallel_bench: %ld elements, up to %d threads\n", elements, max_threads);
+
+	serial = bench_sort(elements, 1);
+	printf("  dlist_sort          : %8.3f sec\n", serial);
+
+	for (threads = 2; threads <= max_threads; threads++) {
+		elapsed = bench_sort(elements, threads);
+		printf("  dlist_sort_parallel : %8.3f sec with %2d threads (%.2fx)\n", elapsed, threads,
+		       serial / elapsed);
+	}
+
+	return 0;
+}
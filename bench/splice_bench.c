@@ -0,0 +1,94 @@
+/**
+ * \file splice_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Benchmark of merging lists element by element versus with list_concat
+ *
+ * Usage: splice_bench [lists] [elements]
+ *
+ * Merges `lists` lists of `elements` elements each into one result list, once by removing and
+ * reinserting every element and once by concatenating whole lists.
+ */
+#include "bench.h"
+
+#include "../src/list.h"
+
+static List *
+make_lists(long lists, long elements)
+{
+	List *parts = (List *)malloc(lists * sizeof (List));
+	long i, j;
+
+	for (i = 0; i < lists; i++) {
+		list_init(&parts[i], NULL);
+
+		for (j = 0; j < elements; j++) {
+			list_insert_next(&parts[i], list_tail(&parts[i]), (void *)j);
+		}
+	}
+
+	return parts;
+}
+
+static void
+free_lists(List *parts, long lists)
+{
+	long i;
+
+	for (i = 0; i < lists; i++) {
+		list_destroy(&parts[i]);
+	}
+
+	free(parts);
+}
+
+int
+main(int argc, char **argv)
+{
+	long lists = bench_arg(argc, argv, 1, 64);
+	long elements = bench_arg(argc, argv, 2, 100000);
+	double start, moved, concatenated;
+	List result, *parts;
+	void *data;
+	long i;
+
+	printf("splice_bench: %ld lists of %ld elements\n", lists, elements);
+
+	// Element by element, as merging had to be done before
+	parts = make_lists(lists, elements);
+	list_init(&result, NULL);
+
+	start = bench_now();
+
+	for (i = 0; i < lists; i++) {
+		while (list_remove_next(&parts[i], NULL, &data) == 0) {
+			list_insert_next(&result, list_tail(&result), data);
+		}
+	}
+
+	moved = bench_now() - start;
+	bench_keep(list_size(&result));
+
+	list_destroy(&result);
+	free_lists(parts, lists);
+
+	// Whole lists at once
+	parts = make_lists(lists, elements);
+	list_init(&result, NULL);
+
+	start = bench_now();
+
+	for (i = 0; i < lists; i++) {
+		list_concat(&result, &parts[i]);
+	}
+
+	concatenated = bench_now() - start;
+	bench_keep(list_size(&result));
+
+	list_destroy(&result);
+	free_lists(parts, lists);
+
+	printf("  remove/insert : %10.6f sec\n", moved);
+	printf("  list_concat   : %10.6f sec (%.0fx)\n", concatenated, moved / concatenated);
+
+	return 0;
+}
@@ -0,0 +1,193 @@
+/**
+ * \file spscqueue_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Benchmark of two-thread hand-off through a mutex-guarded Queue versus SPSCQueue
+ *
+ * Usage: spscqueue_bench [messages] [capacity] [round_trips]
+ *
+ * Throughput streams `messages` from a producer thread to a consumer thread. Latency bounces a
+ * single message between the two threads over a pair of queues `round_trips` times. Both sides
+ * yield the processor whenever the queue is empty (or full).
+ */
+#include "bench.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "../src/queue.h"
+#include "../src/spscqueue.h"
+
+typedef struct Locked_Queue_s {
+	pthread_mutex_t mutex;
+	Queue queue;
+	long capacity;
+
+} Locked_Queue;
+
+typedef struct Channel_s {
+	int locked;
+	Locked_Queue locked_queue[2];
+	SPSCQueue spsc_queue[2];
+	long count;
+
+} Channel;
+
+static void
+channel_send(Channel *channel, int lane, long value)
+{
+	Locked_Queue *locked = &channel->locked_queue[lane];
+	int sent;
+
+	for (;;) {
+		if (channel->locked) {
+			pthread_mutex_lock(&locked->mutex);
+			sent = queue_size(&locked->queue) < locked->capacity &&
+			       queue_enqueue(&locked->queue, (void *)value) == 0;
+			pthread_mutex_unlock(&locked->mutex);
+		} else {
+			sent = spscqueue_enqueue(&channel->spsc_queue[lane], (void *)value) == 0;
+		}
+
+		if (sent) {
+			return;
+		}
+
+		sched_yield();
+	}
+}
+
+static long
+channel_receive(Channel *channel, int lane)
+{
+	Locked_Queue *locked = &channel->locked_queue[lane];
+	void *data;
+	int received;
+
+	for (;;) {
+		if (channel->locked) {
+			pthread_mutex_lock(&locked->mutex);
+			received = queue_dequeue(&locked->queue, &data) == 0;
+			pthread_mutex_unlock(&locked->mutex);
+		} else {
+			received = spscqueue_dequeue(&channel->spsc_queue[lane], &data) == 0;
+		}
+
+		if (received) {
+			return (long)data;
+		}
+
+		sched_yield();
+	}
+}
+
+static void *
+producer_run(void *arg)
+{
+	Channel *channel = (Channel *)arg;
+	long i;
+
+	for (i = 0; i < channel->count; i++) {
+		channel_send(channel, 0, i);
+	}
+
+	return NULL;
+}
+
+static void *
+echo_run(void *arg)
+{
+	Channel *channel = (Channel *)arg;
+	long i;
+
+	for (i = 0; i < channel->count; i++) {
+		channel_send(channel, 1, channel_receive(channel, 0));
+	}
+
+	return NULL;
+}
+
+static void
+channel_init(Channel *channel, int locked, long capacity)
+{
+	int lane;
+
+	channel->locked = locked;
+
+	for (lane = 0; lane < 2; lane++) {
+		pthread_mutex_init(&channel->locked_queue[lane].mutex, NULL);
+		queue_init(&channel->locked_queue[lane].queue, NULL);
+		channel->locked_queue[lane].capacity = capacity;
+		spscqueue_init(&channel->spsc_queue[lane], NULL, capacity);
+	}
+}
+
+static void
+channel_destroy(Channel *channel)
+{
+	int lane;
+
+	for (lane = 0; lane < 2; lane++) {
+		pthread_mutex_destroy(&channel->locked_queue[lane].mutex);
+		queue_destroy(&channel->locked_queue[lane].queue);
+		spscqueue_destroy(&channel->spsc_queue[lane]);
+	}
+}
+
+static void
+bench(int locked, long messages, long capacity, long round_trips)
+{
+	unsigned long sum = 0;
+	double start, throughput, latency;
+	pthread_t thread;
+	Channel channel;
+	long i;
+
+	channel_init(&channel, locked, capacity);
+
+	// Throughput: one-way stream
+	channel.count = messages;
+	start = bench_now();
+	pthread_create(&thread, NULL, producer_run, &channel);
+
+	for (i = 0; i < messages; i++) {
+		sum += channel_receive(&channel, 0);
+	}
+
+	pthread_join(thread, NULL);
+	throughput = messages / (bench_now() - start);
+
+	// Latency: ping-pong
+	channel.count = round_trips;
+	start = bench_now();
+	pthread_create(&thread, NULL, echo_run, &channel);
+
+	for (i = 0; i < round_trips; i++) {
+		channel_send(&channel, 0, i);
+		sum += channel_receive(&channel, 1);
+	}
+
+	pthread_join(thread, NULL);
+	latency = (bench_now() - start) * 1e9 / round_trips;
+	bench_keep(sum);
+
+	printf("  %-12s: %8.2f M msgs/sec, %9.1f ns/round trip\n", locked ? "mutex+Queue" : "SPSCQueue",
+	       throughput / 1e6, latency);
+
+	channel_destroy(&channel);
+}
+
+int
+main(int argc, char **argv)
+{
+	long messages = bench_arg(argc, argv, 1, 20000000);
+	long capacity = bench_arg(argc, argv, 2, 1024);
+	long round_trips = bench_arg(argc, argv, 3, 200000);
+
+	printf("spscqueue_bench: %ld messages, capacity %ld, %ld round trips\n", messages, capacity,
+	       round_trips);
+
+	bench(1, messages, capacity, round_trips);
+	bench(0, messages, capacity, round_trips);
+
+	return 0;
+}
@@ -0,0 +1,98 @@
+/**
+ * \file stack_cache_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Benchmark of per-thread Stack push/pop churn with malloc versus the node cache
+ *
+ * Usage: stack_cache_bench [operations_per_thread] [threads] [burst]
+ */
+#include "bench.h"
+
+#include <pthread.h>
+
+#include "../src/stack.h"
+
+typedef struct Worker_s {
+	int cached;
+	long operations;
+	long burst;
+	Node_Cache_Stats stats;
+
+} Worker;
+
+static void *
+worker_run(void *arg)
+{
+	Worker *worker = (Worker *)arg;
+	Stack stack;
+	void *data;
+	long i, j;
+
+	if (worker->cached) {
+		stack_init_cached(&stack, NULL);
+	} else {
+		stack_init(&stack, NULL);
+	}
+
+	// Push and pop in bursts so the cache has to absorb more than a single element
+	for (i = 0; i < worker->operations; i += worker->burst) {
+		for (j = 0; j < worker->burst; j++) {
+			stack_push(&stack, &worker);
+		}
+
+		for (j = 0; j < worker->burst; j++) {
+			stack_pop(&stack, &data);
+		}
+	}
+
+	stack_destroy(&stack);
+	node_cache_stats(&worker->stats);
+
+	return NULL;
+}
+
+static double
+run(int cached, long operations, long threads, long burst, Node_Cache_Stats *total)
+{
+	pthread_t tid[threads];
+	Worker workers[threads];
+	double start;
+	long i;
+
+	start = bench_now();
+
+	for (i = 0; i < threads; i++) {
+		workers[i].cached = cached;
+		workers[i].operations = operations;
+		workers[i].burst = burst;
+		pthread_create(&tid[i], NULL, worker_run, &workers[i]);
+	}
+
+	total->hits = total->misses = total->trims = 0;
+
+	for (i = 0; i < threads; i++) {
+		pthread_join(tid[i], NULL);
+		total->hits += workers[i].stats.hits;
+		total->misses += workers[i].stats.misses;
+		total->trims += workers[i].stats.trims;
+	}
+
+	return (double)(operations * threads) / (bench_now() - start);
+}
+
+int
+main(int argc, char **argv)
+{
+	long operations = bench_arg(argc, argv, 1, 10000000);
+	long threads = bench_arg(argc, argv, 2, 4);
+	long burst = bench_arg(argc, argv, 3, 16);
+	Node_Cache_Stats total;
+
+	printf("stack_cache_bench: %ld threads x %ld push/pop pairs, bursts of %ld\n", threads,
+	       operations, burst);
+
+	printf("  malloc : %12.0f pairs/sec\n", run(0, operations, threads, burst, &total));
+	printf("  cached : %12.0f pairs/sec", run(1, operations, threads, burst, &total));
+	printf("  (hits %lu, misses %lu, trims %lu)\n", total.hits, total.misses, total.trims);
+
+	return 0;
+}
@@ -0,0 +1,62 @@
+/**
+ * \file teardown_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Benchmark of DList teardown with per-element frees versus arena release
+ *
+ * Usage: teardown_bench [max_size]
+ */
+#include "bench.h"
+
+#include "../src/dlist.h"
+
+static void
+noop_destroy(void *data)
+{
+	bench_keep(data);
+}
+
+static double
+teardown(DList *list, long size)
+{
+	double start;
+	long i;
+
+	dlist_insert_next(list, NULL, NULL);
+
+	for (i = 1; i < size; i++) {
+		dlist_insert_next(list, dlist_tail(list), (void *)i);
+	}
+
+	start = bench_now();
+	dlist_destroy(list);
+
+	return bench_now() - start;
+}
+
+int
+main(int argc, char **argv)
+{
+	long max_size = bench_arg(argc, argv, 1, 10000000);
+	DList list;
+	double t_malloc, t_arena, t_arena_cb;
+	long size;
+
+	printf("teardown_bench: dlist_destroy time in ms\n");
+	printf("  %10s %12s %12s %16s\n", "size", "malloc", "arena", "arena+destroy");
+
+	for (size = 1000; size <= max_size; size *= 10) {
+		dlist_init(&list, NULL);
+		t_malloc = teardown(&list, size);
+
+		dlist_init_arena(&list, NULL, 4096);
+		t_arena = teardown(&list, size);
+
+		dlist_init_arena(&list, noop_destroy, 4096);
+		t_arena_cb = teardown(&list, size);
+
+		printf("  %10ld %12.3f %12.3f %16.3f\n", size, t_malloc * 1e3, t_arena * 1e3,
+		       t_arena_cb * 1e3);
+	}
+
+	return 0;
+}
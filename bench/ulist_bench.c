@@ -0,0 +1,123 @@
+/**
+ * \file ulist_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Benchmark of List versus UList scans, queue churn and memory per element
+ *
+ * Usage: ulist_bench [size] [passes]
+ */
+#include "bench.h"
+
+#include <malloc.h>
+
+#include "../src/list.h"
+#include "../src/ulist.h"
+
+static size_t
+heap_in_use(void)
+{
+	return mallinfo2().uordblks;
+}
+
+static void
+bench_list(long size, long passes)
+{
+	List_Element *element;
+	unsigned long sum = 0;
+	size_t before;
+	double start, scan, churn;
+	void *data;
+	List list;
+	long i;
+
+	before = heap_in_use();
+	list_init(&list, NULL);
+
+	for (i = 0; i < size; i++) {
+		list_insert_next(&list, list_tail(&list), (void *)i);
+	}
+
+	printf("  List  : %6.2f bytes/element", (double)(heap_in_use() - before) / size);
+
+	start = bench_now();
+
+	for (i = 0; i < passes; i++) {
+		for (element = list_head(&list); element != NULL; element = list_next(element)) {
+			sum += (unsigned long)list_data(element);
+		}
+	}
+
+	scan = (bench_now() - start) * 1e9 / ((double)size * passes);
+	bench_keep(sum);
+
+	start = bench_now();
+
+	for (i = 0; i < size; i++) {
+		list_remove_next(&list, NULL, &data);
+		list_insert_next(&list, list_tail(&list), data);
+	}
+
+	churn = (bench_now() - start) * 1e9 / size;
+	printf(", scan %6.2f ns/element, queue churn %6.2f ns/op\n", scan, churn);
+
+	list_destroy(&list);
+}
+
+static void
+bench_ulist(long size, long passes)
+{
+	UList_Iter iter;
+	unsigned long sum = 0;
+	size_t before;
+	double start, scan, churn;
+	void *data;
+	UList list;
+	long i;
+
+	before = heap_in_use();
+	ulist_init(&list, NULL);
+
+	for (i = 0; i < size; i++) {
+		ulist_insert_next(&list, ulist_iter_tail(&list, &iter) == 0 ? &iter : NULL, (void *)i);
+	}
+
+	printf("  UList : %6.2f bytes/element", (double)(heap_in_use() - before) / size);
+
+	start = bench_now();
+
+	for (i = 0; i < passes; i++) {
+		if (ulist_iter_head(&list, &iter) == 0) {
+			do {
+				sum += (unsigned long)ulist_data(&iter);
+			} while (ulist_iter_next(&iter) == 0);
+		}
+	}
+
+	scan = (bench_now() - start) * 1e9 / ((double)size * passes);
+	bench_keep(sum);
+
+	start = bench_now();
+
+	for (i = 0; i < size; i++) {
+		ulist_remove_next(&list, NULL, &data);
+		ulist_insert_next(&list, ulist_iter_tail(&list, &iter) == 0 ? &iter : NULL, data);
+	}
+
+	churn = (bench_now() - start) * 1e9 / size;
+	printf(", scan %6.2f ns/element, queue churn %6.2f ns/op\n", scan, churn);
+
+	ulist_destroy(&list);
+}
+
+int
+main(int argc, char **argv)
+{
+	long size = bench_arg(argc, argv, 1, 5000000);
+	long passes = bench_arg(argc, argv, 2, 5);
+
+	printf("ulist_bench: %ld elements, %ld scan passes\n", size, passes);
+
+	bench_list(size, passes);
+	bench_ulist(size, passes);
+
+	return 0;
+}
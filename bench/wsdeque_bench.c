@@ -0,0 +1,254 @@
+/**
+ * \file wsdeque_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Fork/join benchmark of mutex-guarded DList versus WSDeque task scheduling
+ *
+ * Usage: wsdeque_bench [n] [max_threads] [cutoff]
+ *
+ * Computes fib(`n`) by forking a task for fib(n - 2) and recursing on fib(n - 1), down to
+ * `cutoff`, below which the rest is computed serially. Each worker thread owns a deque of forked
+ * tasks; idle workers steal from a random victim. For each thread count t from 1 to
+ * `max_threads` the run is timed once with a mutex-guarded DList per worker and once with a
+ * WSDeque per worker.
+ */
+#include "bench.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+#include "../src/dlist.h"
+#include "../src/wsdeque.h"
+
+#define MAX_THREADS 64
+
+typedef struct Task_s {
+	int n;
+	long result;
+	atomic_int done;
+
+} Task;
+
+typedef struct Worker_s {
+	unsigned seed;
+
+	WSDeque deque;
+	pthread_mutex_t mutex;
+	DList list;
+
+} Worker;
+
+static Worker workers[MAX_THREADS];
+static int worker_count;
+static int locked;
+static int cutoff;
+static atomic_int finished;
+
+static long
+fib_serial(int n)
+{
+	return n < 2 ? n : fib_serial(n - 1) + fib_serial(n - 2);
+}
+
+static int
+push(Worker *worker, Task *task)
+{
+	int result;
+
+	if (!locked) {
+		return wsdeque_push(&worker->deque, task);
+	}
+
+	pthread_mutex_lock(&worker->mutex);
+	result = dlist_insert_next(&worker->list, dlist_tail(&worker->list), task);
+	pthread_mutex_unlock(&worker->mutex);
+
+	return result;
+}
+
+static int
+pop(Worker *worker, Task **task)
+{
+	int result = -1;
+
+	if (!locked) {
+		return wsdeque_pop(&worker->deque, (void **)task);
+	}
+
+	pthread_mutex_lock(&worker->mutex);
+
+	if (dlist_size(&worker->list) > 0) {
+		result = dlist_remove(&worker->list, dlist_tail(&worker->list), (void **)task);
+	}
+
+	pthread_mutex_unlock(&worker->mutex);
+
+	return result;
+}
+
+static int
+steal(Worker *worker, Task **task)
+{
+	Worker *victim;
+	int result = -1;
+
+	if (worker_count < 2) {
+		return -1;
+	}
+
+	// Pick a random victim other than ourselves
+	worker->seed ^= worker->seed << 13;
+	worker->seed ^= worker->seed >> 17;
+	worker->seed ^= worker->seed << 5;
+	victim = &workers[(worker - workers + 1 + worker->seed % (worker_count - 1)) % worker_count];
+
+	if (!locked) {
+		return wsdeque_steal(&victim->deque, (void **)task);
+	}
+
+	pthread_mutex_lock(&victim->mutex);
+
+	if (dlist_size(&victim->list) > 0) {
+		result = dlist_remove(&victim->list, dlist_head(&victim->list), (void **)task);
+	}
+
+	pthread_mutex_unlock(&victim->mutex);
+
+	return result;
+}
+
+static long fib_task(Worker *worker, int n);
+
+static void
+run(Worker *worker, Task *task)
+{
+	task->result = fib_task(worker, task->n);
+	atomic_store_explicit(&task->done, 1, memory_order_release);
+}
+
+static long
+fib_task(Worker *worker, int n)
+{
+	Task child, *task;
+	long result;
+
+	if (n < cutoff) {
+		return fib_serial(n);
+	}
+
+	// Fork fib(n - 2), falling back to running it inline if it cannot be queued
+	child.n = n - 2;
+	atomic_init(&child.done, 0);
+
+	if (push(worker, &child) != 0) {
+		run(worker, &child);
+	}
+
+	result = fib_task(worker, n - 1);
+
+	// Join, running other tasks while the child is unfinished
+	while (!atomic_load_explicit(&child.done, memory_order_acquire)) {
+		if (pop(worker, &task) == 0 || steal(worker, &task) == 0) {
+			run(worker, task);
+		} else {
+			sched_yield();
+		}
+	}
+
+	return result + child.result;
+}
+
+static void *
+worker_run(void *arg)
+{
+	Worker *worker = (Worker *)arg;
+	Task *task;
+
+	while (!atomic_load_explicit(&finished, memory_order_acquire)) {
+		if (steal(worker, &task) == 0) {
+			run(worker, task);
+		} else {
+			sched_yield();
+		}
+	}
+
+	return NULL;
+}
+
+static double
+bench_fib(int n, int threads, long *result)
+{
+	pthread_t handles[MAX_THREADS];
+	double start, elapsed;
+	int i;
+
+	worker_count = threads;
+	atomic_store(&finished, 0);
+
+	for (i = 0; i < threads; i++) {
+		workers[i].seed = 2463534242u + i;
+		wsdeque_init(&workers[i].deque, NULL, 0);
+		pthread_mutex_init(&workers[i].mutex, NULL);
+		dlist_init(&workers[i].list, NULL);
+	}
+
+	start = bench_now();
+
+	for (i = 1; i < threads; i++) {
+		pthread_create(&handles[i], NULL, worker_run, &workers[i]);
+	}
+
+	// The main thread is worker 0 and runs the root task
+	*result = fib_task(&workers[0], n);
+	atomic_store_explicit(&finished, 1, memory_order_release);
+
+	for (i = 1; i < threads; i++) {
+		pthread_join(handles[i], NULL);
+	}
+
+	elapsed = bench_now() - start;
+
+	for (i = 0; i < threads; i++) {
+		wsdeque_destroy(&workers[i].deque);
+		pthread_mutex_destroy(&workers[i].mutex);
+		dlist_destroy(&workers[i].list);
+	}
+
+	return elapsed;
+}
+
+int
+main(int argc, char **argv)
+{
+	int n = (int)bench_arg(argc, argv, 1, 38);
+	int max_threads = (int)bench_arg(argc, argv, 2, 4);
+	double start, serial, elapsed;
+	long expected, result;
+	int threads;
+
+	cutoff = (int)bench_arg(argc, argv, 3, 10);
+
+	if (max_threads < 1 || max_threads > MAX_THREADS) {
+		fprintf(stderr, "max_threads must be between 1 and %d\n", MAX_THREADS);
+		return 1;
+	}
+
+	printf("wsdeque_bench: fib(%d), cutoff %d, up to %d threads\n", n, cutoff, max_threads);
+
+	start = bench_now();
+	expected = fib_serial(n);
+	serial = bench_now() - start;
+
+	printf("  serial          : %8.3f sec\n", serial);
+
+	for (threads = 1; threads <= max_threads; threads++) {
+		for (locked = 1; locked >= 0; locked--) {
+			elapsed = bench_fib(n, threads, &result);
+
+			printf("  %-7s %2d thr  : %8.3f sec (%.2fx serial)%s\n", locked ? "DList" : "WSDeque",
+			       threads, elapsed, serial / elapsed, result == expected ? "" : " WRONG RESULT");
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,144 @@
+/**
+ * \file xlist_bench.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Benchmark of DList versus XList memory per element and traversal in both directions
+ *
+ * Usage: xlist_bench [smallest size] [largest size]
+ *
+ * Sizes grow tenfold from the smallest to the largest, e.g. `xlist_bench 1000000 100000000`
+ * reports 1M, 10M and 100M elements.
+ */
+#include "bench.h"
+
+#include <malloc.h>
+
+#include "../src/dlist.h"
+#include "../src/xlist.h"
+
+static size_t
+heap_in_use(void)
+{
+	struct mallinfo2 info = mallinfo2();
+
+	// Large slabs are served by mmap, which mallinfo2 reports separately
+	return info.uordblks + info.hblkhd;
+}
+
+static void
+bench_dlist(long size, int arena)
+{
+	DList_Element *element;
+	unsigned long sum = 0;
+	size_t before;
+	double start, forward, backward;
+	DList list;
+	long i;
+
+	before = heap_in_use();
+
+	if (arena) {
+		dlist_init_arena(&list, NULL, 4096);
+	} else {
+		dlist_init(&list, NULL);
+	}
+
+	dlist_insert_next(&list, NULL, (void *)0);
+
+	for (i = 1; i < size; i++) {
+		dlist_insert_next(&list, dlist_tail(&list), (void *)i);
+	}
+
+	printf("  DList %-6s: %6.2f bytes/element", arena ? "arena" : "malloc",
+	       (double)(heap_in_use() - before) / size);
+
+	start = bench_now();
+
+	for (element = dlist_head(&list); element != NULL; element = dlist_next(element)) {
+		sum += (unsigned long)dlist_data(element);
+	}
+
+	forward = (bench_now() - start) * 1e9 / size;
+	start = bench_now();
+
+	for (element = dlist_tail(&list); element != NULL; element = dlist_prev(element)) {
+		sum += (unsigned long)dlist_data(element);
+	}
+
+	backward = (bench_now() - start) * 1e9 / size;
+	bench_keep(sum);
+
+	printf(", forward %6.2f ns/element, backward %6.2f ns/element\n", forward, backward);
+
+	dlist_destroy(&list);
+}
+
+static void
+bench_xlist(long size, int arena)
+{
+	XList_Cursor cursor;
+	unsigned long sum = 0;
+	size_t before;
+	double start, forward, backward;
+	XList list;
+	long i;
+
+	before = heap_in_use();
+
+	if (arena) {
+		xlist_init_arena(&list, NULL, 4096);
+	} else {
+		xlist_init(&list, NULL);
+	}
+
+	xlist_insert_next(&list, NULL, (void *)0);
+	xlist_cursor_head(&list, &cursor);
+
+	for (i = 1; i < size; i++) {
+		xlist_insert_next(&list, &cursor, (void *)i);
+		xlist_next(&cursor);
+	}
+
+	printf("  XList %-6s: %6.2f bytes/element", arena ? "arena" : "malloc",
+	       (double)(heap_in_use() - before) / size);
+
+	start = bench_now();
+	xlist_cursor_head(&list, &cursor);
+
+	do {
+		sum += (unsigned long)xlist_data(&cursor);
+	} while (xlist_next(&cursor) == 0);
+
+	forward = (bench_now() - start) * 1e9 / size;
+	start = bench_now();
+	xlist_cursor_tail(&list, &cursor);
+
+	do {
+		sum += (unsigned long)xlist_data(&cursor);
+	} while (xlist_prev(&cursor) == 0);
+
+	backward = (bench_now() - start) * 1e9 / size;
+	bench_keep(sum);
+
+	printf(", forward %6.2f ns/element, backward %6.2f ns/element\n", forward, backward);
+
+	xlist_destroy(&list);
+}
+
+int
+main(int argc, char **argv)
+{
+	long smallest = bench_arg(argc, argv, 1, 1000000);
+	long largest = bench_arg(argc, argv, 2, 10000000);
+	long size;
+
+	for (size = smallest; size <= largest; size *= 10) {
+		printf("xlist_bench: %ld elements\n", size);
+
+		bench_dlist(size, 0);
+		bench_xlist(size, 0);
+		bench_dlist(size, 1);
+		bench_xlist(size, 1);
+	}
+
+	return 0;
+}
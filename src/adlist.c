@@ -0,0 +1,243 @@
+/**
+ * \file adlist.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of a generic doubly linked-list ADT stored in a contiguous array
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "adlist.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// List Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+static uint32_t
+element_new(ADList *list, const void *data)
+{
+	uint32_t element, capacity;
+
+	if (list->free_list != ADLIST_NIL) {
+		// Reuse a slot from the free chain
+		element = list->free_list;
+		list->free_list = list->elements[element].next;
+	} else {
+		// Take the next untouched slot, doubling the array when it is full
+		if (list->used == list->capacity) {
+			if (list->capacity >= ADLIST_MAX_CAPACITY / 2) {
+				capacity = ADLIST_MAX_CAPACITY;
+			} else if (list->capacity == 0) {
+				capacity = ADLIST_DEFAULT_CAPACITY;
+			} else {
+				capacity = list->capacity * 2;
+			}
+
+			if (capacity <= list->capacity || adlist_reserve(list, capacity) != 0) {
+				return ADLIST_NIL;
+			}
+		}
+
+		element = list->used++;
+	}
+
+	list->elements[element].data = (void *)data;
+
+	return element;
+}
+
+void
+adlist_init(ADList *list, void (*destroy)(void *data))
+{
+	// Initialize the list
+	list->size = 0;
+	list->destroy = destroy;
+	list->head = ADLIST_NIL;
+	list->tail = ADLIST_NIL;
+	list->free_list = ADLIST_NIL;
+	list->used = 0;
+	list->capacity = 0;
+	list->elements = NULL;
+}
+
+void
+adlist_destroy(ADList *list)
+{
+	uint32_t element;
+
+	// Only the data needs visiting, the elements all go away with the array
+	if (list->destroy != NULL) {
+		for (element = list->head; element != ADLIST_NIL; element = adlist_next(list, element)) {
+			list->destroy(adlist_data(list, element));
+		}
+	}
+
+	free(list->elements);
+
+	// No operations permitted at this point -- clear memory as precaution
+	memset(list, 0, sizeof (ADList));
+}
+
+int
+adlist_reserve(ADList *list, uint32_t capacity)
+{
+	ADList_Element *elements;
+
+	// Also keeps ADLIST_NIL from ever being a valid index
+	if (capacity > ADLIST_MAX_CAPACITY) {
+		return -1;
+	}
+
+	if (capacity <= list->capacity) {
+		return 0;
+	}
+
+	if ((elements = (ADList_Element *)realloc(list->elements,
+	                                          (size_t)capacity * sizeof (ADList_Element))) == NULL) {
+		return -1;
+	}
+
+	list->elements = elements;
+	list->capacity = capacity;
+
+	return 0;
+}
+
+int
+adlist_insert_next(ADList *list, uint32_t element, const void *data)
+{
+	uint32_t new_element;
+	ADList_Element *elements;
+
+	// Do not allow ADLIST_NIL unless the list is empty
+	if (element == ADLIST_NIL && adlist_size(list) != 0) {
+		return -1;
+	}
+
+	// Obtain a slot for the element
+	if ((new_element = element_new(list, data)) == ADLIST_NIL) {
+		return -1;
+	}
+
+	elements = list->elements;
+
+	if (adlist_size(list) == 0) {
+		// Insert into empty list
+
+		elements[new_element].prev = ADLIST_NIL;
+		elements[new_element].next = ADLIST_NIL;
+		list->head = new_element;
+		list->tail = new_element;
+	} else {
+		// Insert into non-empty list
+
+		elements[new_element].next = elements[element].next;
+		elements[new_element].prev = element;
+
+		if (elements[element].next == ADLIST_NIL) {
+			list->tail = new_element;
+		} else {
+			elements[elements[element].next].prev = new_element;
+		}
+
+		elements[element].next = new_element;
+	}
+
+	// Adjust the size
+	list->size++;
+
+	return 0;
+}
+
+int
+adlist_insert_prev(ADList *list, uint32_t element, const void *data)
+{
+	uint32_t new_element;
+	ADList_Element *elements;
+
+	// Do not allow ADLIST_NIL unless the list is empty
+	if (element == ADLIST_NIL && adlist_size(list) != 0) {
+		return -1;
+	}
+
+	// Obtain a slot for the element
+	if ((new_element = element_new(list, data)) == ADLIST_NIL) {
+		return -1;
+	}
+
+	elements = list->elements;
+
+	if (adlist_size(list) == 0) {
+		// Insert into empty list
+
+		elements[new_element].prev = ADLIST_NIL;
+		elements[new_element].next = ADLIST_NIL;
+		list->head = new_element;
+		list->tail = new_element;
+	} else {
+		// Insert into non-empty list
+
+		elements[new_element].next = element;
+		elements[new_element].prev = elements[element].prev;
+
+		if (elements[element].prev == ADLIST_NIL) {
+			list->head = new_element;
+		} else {
+			elements[elements[element].prev].next = new_element;
+		}
+
+		elements[element].prev = new_element;
+	}
+
+	// Adjust the size
+	list->size++;
+
+	return 0;
+}
+
+int
+adlist_remove(ADList *list, uint32_t element, void **data)
+{
+	ADList_Element *elements = list->elements;
+
+	// Do not allow ADLIST_NIL or removal from empty list
+	if (element == ADLIST_NIL || element >= list->used || adlist_size(list) == 0) {
+		return -1;
+	}
+
+	// Remove the element from the linked-list
+
+	if (element == list->head) {
+		// Remove from the head of the list
+
+		list->head = elements[element].next;
+
+		if (list->head == ADLIST_NIL) {
+			list->tail = ADLIST_NIL;
+		} else {
+			elements[list->head].prev = ADLIST_NIL;
+		}
+	} else {
+		// Remove from somewhere but the head
+
+		elements[elements[element].prev].next = elements[element].next;
+
+		if (elements[element].next == ADLIST_NIL) {
+			list->tail = elements[element].prev;
+		} else {
+			elements[elements[element].next].prev = elements[element].prev;
+		}
+	}
+
+	*data = elements[element].data;
+
+	// Push the slot onto the free chain
+	elements[element].next = list->free_list;
+	list->free_list = element;
+
+	// Adjust the size of the list
+	list->size--;
+
+	return 0;
+}
@@ -0,0 +1,231 @@
+/**
+ * \file adlist.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Definitions of a generic doubly linked-list ADT stored in a contiguous array
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#ifndef ADLIST_h
+#define ADLIST_h
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <limits.h>
+#include <stdint.h>
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+/**
+ * Index that refers to no element, playing the role NULL plays for a DList
+ */
+#define ADLIST_NIL UINT32_MAX
+
+/**
+ * Largest number of elements a list can hold, so that its `int` size cannot overflow
+ */
+#define ADLIST_MAX_CAPACITY ((uint32_t)INT_MAX)
+
+/**
+ * Number of elements reserved by the first insert into a list that has no storage yet
+ */
+#define ADLIST_DEFAULT_CAPACITY 16
+
+/**
+ * \struct ADList_Element
+ * \brief Generic array-backed doubly linked-list element
+ *
+ * Elements refer to each other by their index in the list's array, which makes an element 16
+ * bytes against the 24 of a DList_Element and keeps the links valid when the array is moved.
+ */
+typedef struct ADList_Element_s {
+	void *data;    ///< Pointer to data
+
+	uint32_t prev; ///< Index of prev element in list, or ADLIST_NIL
+	uint32_t next; ///< Index of next element in list (or in the free chain), or ADLIST_NIL
+
+} ADList_Element;
+
+/**
+ * \struct ADList
+ * \brief Generic doubly linked-list whose elements live in one growable array
+ */
+typedef struct ADList_s {
+	int size; ///< Number of elements in list
+
+	void (*destroy)(void *data); ///< Function pointer to destroy element
+
+	uint32_t head;      ///< Index of first element in list, or ADLIST_NIL
+	uint32_t tail;      ///< Index of last element in list, or ADLIST_NIL
+	uint32_t free_list; ///< Index of first recycled slot, or ADLIST_NIL
+
+	uint32_t used;      ///< Number of slots ever handed out
+	uint32_t capacity;  ///< Number of slots in `elements`
+
+	ADList_Element *elements; ///< Storage for all elements
+
+} ADList;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// List Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * \brief Function to initialize an array-backed doubly linked-list
+ *
+ * \pre Must be called before list can be used by any other operation
+ *
+ * No storage is reserved until the first insert (or *adlist_reserve*). See *dlist_init* for the
+ * meaning of `destroy`.
+ *
+ * Complexity: O(1)
+ *
+ * \param list    The doubly linked-list to init
+ * \param destroy Function pointer to free data element memory
+ */
+void
+adlist_init(ADList *list, void (*destroy)(void *data));
+
+/**
+ * \brief Function to destroy an array-backed doubly linked-list
+ *
+ * Calls the function passed as `destroy` to *adlist_init* once for each element, provided
+ * `destroy` was not set to NULL, and then frees the array in one go.
+ *
+ * \note
+ * No operation is permitted after *adlist_destroy* is called unless *adlist_init* is called
+ * again.
+ *
+ * Complexity: O(n), or O(1) if `destroy` is NULL
+ *
+ * \param list The doubly linked-list to destroy
+ */
+void
+adlist_destroy(ADList *list);
+
+/**
+ * \brief Function to reserve storage in an array-backed doubly linked-list
+ *
+ * Grows the array so that it holds at least `capacity` elements, so that inserts up to that
+ * size do not need to reallocate. Never shrinks the array.
+ *
+ * Complexity: O(n)
+ *
+ * \param list     The doubly linked-list to reserve storage in
+ * \param capacity Number of elements to make room for
+ *
+ * \return 0 if the storage is available, otherwise -1 (including when `capacity` is more than
+ *         ADLIST_MAX_CAPACITY)
+ */
+int
+adlist_reserve(ADList *list, uint32_t capacity);
+
+/**
+ * \brief Function to insert an element into an array-backed doubly linked-list
+ *
+ * Inserts an element just after the element at index `element`. When inserting into an empty
+ * list, `element` should be ADLIST_NIL. Freed slots are reused first; otherwise the array grows
+ * by doubling, which moves the elements but leaves their indices (and so the links) intact.
+ *
+ * \note
+ * Pointers obtained with *adlist_element* are invalidated by any insert; indices are not.
+ *
+ * Complexity: O(1) amortized
+ *
+ * \param list    The doubly linked-list to insert element into
+ * \param element Index of element to insert after
+ * \param data    The data to insert
+ *
+ * \return 0 if inserting into list was successful, otherwise -1
+ */
+int
+adlist_insert_next(ADList *list, uint32_t element, const void *data);
+
+/**
+ * \brief Function to insert an element into an array-backed doubly linked-list
+ *
+ * Inserts an element just before the element at index `element`. When inserting into an empty
+ * list, `element` should be ADLIST_NIL. See *adlist_insert_next*.
+ *
+ * Complexity: O(1) amortized
+ *
+ * \param list    The doubly linked-list to insert element into
+ * \param element Index of element to insert before
+ * \param data    The data to insert
+ *
+ * \return 0 if inserting into list was successful, otherwise -1
+ */
+int
+adlist_insert_prev(ADList *list, uint32_t element, const void *data);
+
+/**
+ * \brief Function to remove an element from an array-backed doubly linked-list
+ *
+ * Removes the element at index `element` from the doubly linked-list. Upon return `data` points
+ * to the data stored in the element that was removed. The slot is pushed onto the list's free
+ * chain and handed out again by a later insert.
+ *
+ * Complexity: O(1)
+ *
+ * \param list    The doubly linked-list to remove element from
+ * \param element Index of element to remove
+ * \param data    Pointer to data removed
+ *
+ * \return 0 if removing from list was successful, otherwise -1
+ */
+int
+adlist_remove(ADList *list, uint32_t element, void **data);
+
+/**
+ * MACRO that evaluates to the number of elements in the doubly linked-list
+ */
+#define adlist_size(list) ((list)->size)
+
+/**
+ * MACRO that evaluates to the index of the element at the head of a doubly linked-list
+ */
+#define adlist_head(list) ((list)->head)
+
+/**
+ * MACRO that evaluates to the index of the element at the tail of a doubly linked-list
+ */
+#define adlist_tail(list) ((list)->tail)
+
+/**
+ * MACRO that evaluates to a pointer to the element at given index of a doubly linked-list
+ */
+#define adlist_element(list, element) (&(list)->elements[(element)])
+
+/**
+ * MACRO that determines whether element is the head of doubly linked-list
+ */
+#define adlist_is_head(list, element) ((list)->elements[(element)].prev == ADLIST_NIL ? 1 : 0)
+
+/**
+ * MACRO that determines whether element is the tail of doubly linked-list
+ */
+#define adlist_is_tail(list, element) ((list)->elements[(element)].next == ADLIST_NIL ? 1 : 0)
+
+/**
+ * MACRO that evaluates to the data stored in given element of a doubly linked-list
+ */
+#define adlist_data(list, element) ((list)->elements[(element)].data)
+
+/**
+ * MACRO that evaluates to the index of the next element given an element in a doubly linked-list
+ */
+#define adlist_next(list, element) ((list)->elements[(element)].next)
+
+/**
+ * MACRO that evaluates to the index of the prev element given an element in a doubly linked-list
+ */
+#define adlist_prev(list, element) ((list)->elements[(element)].prev)
+
+#ifdef __cplusplus
+}
+#endif
+#endif // ADLIST_h
@@ -0,0 +1,28 @@
+/**
+ * \file allocator.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of the default allocator
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include <stdlib.h>
+
+#include "allocator.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Allocator Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+static void *
+default_alloc(void *context, size_t size)
+{
+	return malloc(size);
+}
+
+static void
+default_free(void *context, void *ptr, size_t size)
+{
+	free(ptr);
+}
+
+const Allocator allocator_default = { default_alloc, default_free, NULL, NULL };
@@ -0,0 +1,66 @@
+/**
+ * \file allocator.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Definitions of the allocator descriptor used for ADT element storage
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#ifndef ALLOCATOR_h
+#define ALLOCATOR_h
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+/**
+ * \struct Allocator
+ * \brief Descriptor of the functions an ADT uses to allocate and free its elements
+ *
+ * All functions receive `context` as their first argument, which lets a single implementation
+ * serve several arenas, caches or shared-memory segments. *free* is also passed the size that
+ * was requested from *alloc*, so sized allocators need not store it themselves.
+ *
+ * *release* is optional. When it is set the allocator is an arena owned by exactly one ADT
+ * instance: the ADT's destroy function skips the per-element *free* calls and instead calls
+ * *release* once, which must give back every outstanding allocation along with the context.
+ */
+typedef struct Allocator_s {
+	void *(*alloc)(void *context, size_t size);          ///< Allocate `size` bytes, NULL on error
+	void (*free)(void *context, void *ptr, size_t size); ///< Release memory from *alloc*
+	void (*release)(void *context);                      ///< Release everything at once, or NULL
+	void *context;                                       ///< Opaque pointer passed to all of them
+
+} Allocator;
+
+/**
+ * Allocator that forwards to *malloc* and *free*; used by the plain *_init* functions
+ */
+extern const Allocator allocator_default;
+
+/**
+ * MACRO that allocates `size` bytes through an allocator
+ */
+#define allocator_alloc(allocator, size) ((allocator)->alloc((allocator)->context, (size)))
+
+/**
+ * MACRO that frees `ptr` of `size` bytes through an allocator
+ */
+#define allocator_free(allocator, ptr, size) ((allocator)->free((allocator)->context, (ptr), (size)))
+
+/**
+ * MACRO that determines whether memory from one allocator may be freed through the other
+ */
+#define allocator_same(a, b) \
+	((a)->alloc == (b)->alloc && (a)->free == (b)->free && (a)->context == (b)->context)
+
+#ifdef __cplusplus
+}
+#endif
+#endif // ALLOCATOR_h
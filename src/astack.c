@@ -0,0 +1,112 @@
+/**
+ * \file astack.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of a generic array-backed stack ADT
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "astack.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Stack Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+static int
+resize(AStack *stack, size_t capacity)
+{
+	void **data;
+
+	if ((data = (void **)realloc(stack->data, capacity * sizeof (void *))) == NULL) {
+		return -1;
+	}
+
+	stack->data = data;
+	stack->capacity = capacity;
+
+	return 0;
+}
+
+void
+astack_init(AStack *stack, void (*destroy)(void *data))
+{
+	// Initialize the stack
+	stack->size = 0;
+	stack->destroy = destroy;
+	stack->data = NULL;
+	stack->capacity = 0;
+	stack->reserved = 0;
+	stack->shrink = 0;
+}
+
+void
+astack_destroy(AStack *stack)
+{
+	// Destroy the data of each element, top of the stack first
+	if (stack->destroy != NULL) {
+		while (stack->size > 0) {
+			stack->destroy(stack->data[--stack->size]);
+		}
+	}
+
+	free(stack->data);
+
+	// No operations permitted at this point -- clear memory as precaution
+	memset(stack, 0, sizeof (AStack));
+}
+
+int
+astack_reserve(AStack *stack, size_t capacity)
+{
+	if (capacity > stack->capacity && resize(stack, capacity) != 0) {
+		return -1;
+	}
+
+	if (capacity > stack->reserved) {
+		stack->reserved = capacity;
+	}
+
+	return 0;
+}
+
+int
+astack_push(AStack *stack, const void *data)
+{
+	// Double the array when it is full
+	if ((size_t)stack->size == stack->capacity) {
+		if (resize(stack, stack->capacity == 0 ? ASTACK_DEFAULT_CAPACITY : stack->capacity * 2) != 0) {
+			return -1;
+		}
+	}
+
+	stack->data[stack->size++] = (void *)data;
+
+	return 0;
+}
+
+int
+astack_pop(AStack *stack, void **data)
+{
+	size_t capacity;
+
+	// Do not allow pop from empty stack
+	if (stack->size == 0) {
+		return -1;
+	}
+
+	*data = stack->data[--stack->size];
+
+	// Halve the array once it is down to a quarter full, so it is half full afterwards
+	if (stack->shrink && (size_t)stack->size <= stack->capacity / 4) {
+		capacity = stack->capacity / 2;
+
+		if (capacity >= ASTACK_DEFAULT_CAPACITY && capacity >= stack->reserved) {
+			// Keeping the larger array is harmless if the smaller one cannot be had
+			resize(stack, capacity);
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,150 @@
+/**
+ * \file astack.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Definitions of a generic array-backed stack ADT
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#ifndef ASTACK_h
+#define ASTACK_h
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+/**
+ * Number of slots allocated by the first push onto a stack that has no storage yet
+ */
+#define ASTACK_DEFAULT_CAPACITY 16
+
+/**
+ * \struct AStack
+ * \brief Generic stack holding its data pointers in one growable array
+ *
+ * The array doubles when full, so once the stack has reached its working depth *astack_push* and
+ * *astack_pop* never allocate. With shrinking enabled (see *astack_set_shrink*), the array is
+ * halved once the stack drains to a quarter of its capacity; the gap between the two thresholds
+ * keeps a stack oscillating around a power of two from reallocating on every push and pop.
+ */
+typedef struct AStack_s {
+	int size; ///< Number of elements in stack
+
+	void (*destroy)(void *data); ///< Function pointer to destroy element
+
+	void **data;     ///< Array of data pointers, bottom of the stack first
+	size_t capacity; ///< Number of slots in `data`
+	size_t reserved; ///< Capacity that shrinking never goes below
+	int shrink;      ///< Nonzero to release storage as the stack drains
+
+} AStack;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Stack Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * \brief Function to initialize an array-backed stack
+ *
+ * \pre Must be called before stack can be used by any other operation
+ *
+ * No storage is allocated until the first push (or *astack_reserve*), and shrinking is off. See
+ * *list_init* for the meaning of `destroy`.
+ *
+ * Complexity: O(1)
+ *
+ * \param stack   The stack to init
+ * \param destroy Function pointer to free data element memory
+ */
+void
+astack_init(AStack *stack, void (*destroy)(void *data));
+
+/**
+ * \brief Function to destroy an array-backed stack
+ *
+ * Calls the function passed as `destroy` to *astack_init* once for each element still on the
+ * stack, provided `destroy` was not set to NULL, and frees the array.
+ *
+ * \note
+ * No operation is permitted after *astack_destroy* is called unless *astack_init* is called
+ * again.
+ *
+ * Complexity: O(n), or O(1) if `destroy` is NULL
+ *
+ * \param stack The stack to destroy
+ */
+void
+astack_destroy(AStack *stack);
+
+/**
+ * \brief Function to reserve storage in an array-backed stack
+ *
+ * Grows the array so that it holds at least `capacity` elements, and makes that capacity the
+ * floor below which shrinking will not go.
+ *
+ * Complexity: O(n)
+ *
+ * \param stack    The stack to reserve storage in
+ * \param capacity Number of elements to make room for
+ *
+ * \return 0 if the storage is available, otherwise -1
+ */
+int
+astack_reserve(AStack *stack, size_t capacity);
+
+/**
+ * \brief Function to push an element to the top of the stack
+ *
+ * Complexity: O(1) amortized
+ *
+ * \param stack The stack to push element onto
+ * \param data  The data to push
+ *
+ * \return 0 if stack push was successful, otherwise -1
+ */
+int
+astack_push(AStack *stack, const void *data);
+
+/**
+ * \brief Function to pop an element off the top of the stack
+ *
+ * Complexity: O(1) amortized
+ *
+ * \param stack The stack to pop the element from
+ * \param data  The data popped off the stack
+ *
+ * \return 0 if stack pop was successful, otherwise -1
+ */
+int
+astack_pop(AStack *stack, void **data);
+
+/**
+ * MACRO to enable (nonzero) or disable (0) releasing storage as the stack drains
+ */
+#define astack_set_shrink(stack, enable) ((stack)->shrink = (enable))
+
+/**
+ * MACRO that provides mechanism to inspect the element at top of stack
+ */
+#define astack_peek(stack) ((stack)->size == 0 ? NULL : (stack)->data[(stack)->size - 1])
+
+/**
+ * MACRO that evaluates to the number of elements in the stack
+ */
+#define astack_size(stack) ((stack)->size)
+
+/**
+ * MACRO that evaluates to the number of elements the stack can hold without growing
+ */
+#define astack_capacity(stack) ((stack)->capacity)
+
+#ifdef __cplusplus
+}
+#endif
+#endif // ASTACK_h
@@ -0,0 +1,337 @@
+/**
+ * \file bqueue.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of a blocking queue ADT for passing data between threads
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+
+#include "bqueue.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Queue Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+static void
+deadline_after(struct timespec *deadline, long timeout_ms)
+{
+	// The start of the monotonic clock has long passed, so a zero deadline means do not wait
+	if (timeout_ms <= 0) {
+		deadline->tv_sec = 0;
+		deadline->tv_nsec = 0;
+		return;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, deadline);
+
+	deadline->tv_sec += timeout_ms / 1000;
+	deadline->tv_nsec += (timeout_ms % 1000) * 1000000L;
+
+	if (deadline->tv_nsec >= 1000000000L) {
+		deadline->tv_sec++;
+		deadline->tv_nsec -= 1000000000L;
+	}
+}
+
+static int
+expired(const struct timespec *deadline)
+{
+	return deadline != NULL && deadline->tv_sec == 0 && deadline->tv_nsec == 0 ? -1 : 0;
+}
+
+static int
+is_full(const BQueue *queue)
+{
+	return queue->capacity > 0 && (size_t)rqueue_size(&queue->queue) >= queue->capacity;
+}
+
+// Enqueue with the mutex held, waiting for room until `deadline` (forever if NULL)
+static int
+enqueue_locked(BQueue *queue, const void *data, const struct timespec *deadline)
+{
+	int result = expired(deadline);
+
+	while (!queue->closed && is_full(queue) && result == 0) {
+		queue->waiting_producers++;
+
+		if (deadline == NULL) {
+			pthread_cond_wait(&queue->not_full, &queue->mutex);
+		} else if (pthread_cond_timedwait(&queue->not_full, &queue->mutex, deadline) == ETIMEDOUT) {
+			result = -1;
+		}
+
+		queue->waiting_producers--;
+	}
+
+	if (queue->closed || is_full(queue) || rqueue_enqueue(&queue->queue, data) != 0) {
+		return -1;
+	}
+
+	// Only pay for a wake-up if somebody is asleep
+	if (queue->waiting_consumers > 0) {
+		pthread_cond_signal(&queue->not_empty);
+	}
+
+	return 0;
+}
+
+// Dequeue with the mutex held, waiting for an element until `deadline` (forever if NULL)
+static int
+dequeue_locked(BQueue *queue, void **data, const struct timespec *deadline)
+{
+	int result = expired(deadline);
+
+	while (!queue->closed && rqueue_size(&queue->queue) == 0 && result == 0) {
+		queue->waiting_consumers++;
+
+		if (deadline == NULL) {
+			pthread_cond_wait(&queue->not_empty, &queue->mutex);
+		} else if (pthread_cond_timedwait(&queue->not_empty, &queue->mutex, deadline) == ETIMEDOUT) {
+			result = -1;
+		}
+
+		queue->waiting_consumers--;
+	}
+
+	// A closed queue still hands out what it holds
+	if (rqueue_dequeue(&queue->queue, data) != 0) {
+		return -1;
+	}
+
+	if (queue->waiting_producers > 0) {
+		pthread_cond_signal(&queue->not_full);
+	}
+
+	return 0;
+}
+
+// Enqueue up to `count` elements with the mutex held, waiting for room for each in turn
+static int
+enqueue_n_locked(BQueue *queue, void *const *data, int count)
+{
+	int enqueued = 0;
+
+	while (enqueued < count && !queue->closed) {
+		while (!queue->closed && is_full(queue)) {
+			// Let consumers at what is already in before going to sleep
+			if (queue->waiting_consumers > 0) {
+				pthread_cond_broadcast(&queue->not_empty);
+			}
+
+			queue->waiting_producers++;
+			pthread_cond_wait(&queue->not_full, &queue->mutex);
+			queue->waiting_producers--;
+		}
+
+		// Move everything that fits in one go
+		while (enqueued < count && !queue->closed && !is_full(queue)) {
+			if (rqueue_enqueue(&queue->queue, data[enqueued]) != 0) {
+				return enqueued;
+			}
+
+			enqueued++;
+		}
+	}
+
+	if (enqueued > 0 && queue->waiting_consumers > 0) {
+		if (enqueued == 1) {
+			pthread_cond_signal(&queue->not_empty);
+		} else {
+			pthread_cond_broadcast(&queue->not_empty);
+		}
+	}
+
+	return enqueued;
+}
+
+int
+bqueue_init(BQueue *queue, void (*destroy)(void *data), size_t capacity)
+{
+	pthread_condattr_t attr;
+
+	if (pthread_condattr_init(&attr) != 0) {
+		return -1;
+	}
+
+	// Timed waits use the monotonic clock
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+
+	if (pthread_mutex_init(&queue->mutex, NULL) != 0) {
+		pthread_condattr_destroy(&attr);
+		return -1;
+	}
+
+	if (pthread_cond_init(&queue->not_empty, &attr) != 0) {
+		pthread_mutex_destroy(&queue->mutex);
+		pthread_condattr_destroy(&attr);
+		return -1;
+	}
+
+	if (pthread_cond_init(&queue->not_full, &attr) != 0) {
+		pthread_cond_destroy(&queue->not_empty);
+		pthread_mutex_destroy(&queue->mutex);
+		pthread_condattr_destroy(&attr);
+		return -1;
+	}
+
+	pthread_condattr_destroy(&attr);
+
+	// Initialize the queue
+	rqueue_init(&queue->queue, destroy);
+
+	if (capacity > 0 && rqueue_reserve(&queue->queue, capacity) != 0) {
+		bqueue_destroy(queue);
+		return -1;
+	}
+
+	queue->capacity = capacity;
+	queue->closed = 0;
+	queue->waiting_consumers = 0;
+	queue->waiting_producers = 0;
+
+	return 0;
+}
+
+void
+bqueue_destroy(BQueue *queue)
+{
+	rqueue_destroy(&queue->queue);
+
+	pthread_cond_destroy(&queue->not_full);
+	pthread_cond_destroy(&queue->not_empty);
+	pthread_mutex_destroy(&queue->mutex);
+
+	// No operations permitted at this point -- clear memory as precaution
+	memset(queue, 0, sizeof (BQueue));
+}
+
+void
+bqueue_close(BQueue *queue)
+{
+	pthread_mutex_lock(&queue->mutex);
+
+	queue->closed = 1;
+
+	pthread_cond_broadcast(&queue->not_empty);
+	pthread_cond_broadcast(&queue->not_full);
+
+	pthread_mutex_unlock(&queue->mutex);
+}
+
+int
+bqueue_enqueue(BQueue *queue, const void *data)
+{
+	int result;
+
+	pthread_mutex_lock(&queue->mutex);
+	result = enqueue_locked(queue, data, NULL);
+	pthread_mutex_unlock(&queue->mutex);
+
+	return result;
+}
+
+int
+bqueue_enqueue_timed(BQueue *queue, const void *data, long timeout_ms)
+{
+	struct timespec deadline;
+	int result;
+
+	deadline_after(&deadline, timeout_ms);
+
+	pthread_mutex_lock(&queue->mutex);
+	result = enqueue_locked(queue, data, &deadline);
+	pthread_mutex_unlock(&queue->mutex);
+
+	return result;
+}
+
+int
+bqueue_dequeue(BQueue *queue, void **data)
+{
+	int result;
+
+	pthread_mutex_lock(&queue->mutex);
+	result = dequeue_locked(queue, data, NULL);
+	pthread_mutex_unlock(&queue->mutex);
+
+	return result;
+}
+
+int
+bqueue_dequeue_timed(BQueue *queue, void **data, long timeout_ms)
+{
+	struct timespec deadline;
+	int result;
+
+	deadline_after(&deadline, timeout_ms);
+
+	pthread_mutex_lock(&queue->mutex);
+	result = dequeue_locked(queue, data, &deadline);
+	pthread_mutex_unlock(&queue->mutex);
+
+	return result;
+}
+
+int
+bqueue_size(BQueue *queue)
+{
+	int size;
+
+	pthread_mutex_lock(&queue->mutex);
+	size = rqueue_size(&queue->queue);
+	pthread_mutex_unlock(&queue->mutex);
+
+	return size;
+}
+
+int
+bqueue_is_closed(BQueue *queue)
+{
+	int closed;
+
+	pthread_mutex_lock(&queue->mutex);
+	closed = queue->closed;
+	pthread_mutex_unlock(&queue->mutex);
+
+	return closed;
+}
+
+int
+bqueue_enqueue_n(BQueue *queue, void *const *data, int count)
+{
+	int result;
+
+	pthread_mutex_lock(&queue->mutex);
+	result = enqueue_n_locked(queue, data, count);
+	pthread_mutex_unlock(&queue->mutex);
+
+	return result;
+}
+
+int
+bqueue_dequeue_n(BQueue *queue, void **data, int count)
+{
+	int dequeued = 0;
+
+	pthread_mutex_lock(&queue->mutex);
+
+	// Wait for the first element only, then take whatever else is there
+	if (count > 0 && dequeue_locked(queue, &data[0], NULL) == 0) {
+		dequeued = 1;
+
+		while (dequeued < count && rqueue_dequeue(&queue->queue, &data[dequeued]) == 0) {
+			dequeued++;
+		}
+
+		if (dequeued > 1 && queue->waiting_producers > 0) {
+			pthread_cond_broadcast(&queue->not_full);
+		}
+	}
+
+	pthread_mutex_unlock(&queue->mutex);
+
+	return dequeued;
+}
@@ -0,0 +1,208 @@
+/**
+ * \file bqueue.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Definitions of a blocking queue ADT for passing data between threads
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#ifndef BQUEUE_h
+#define BQUEUE_h
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <pthread.h>
+#include <stddef.h>
+
+#include "rqueue.h"
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+/**
+ * \struct BQueue
+ * \brief Queue whose dequeue waits while it is empty (and enqueue while it is full, if bounded)
+ *
+ * A ring-buffer queue guarded by a mutex, with condition variables for threads to sleep on. The
+ * counts of sleeping threads are tracked so that an operation on a queue nobody waits on only
+ * takes and releases the mutex, which glibc does without a system call when uncontended. Timed
+ * waits are measured against CLOCK_MONOTONIC, so they are not affected by changes of the wall
+ * clock.
+ */
+typedef struct BQueue_s {
+	RQueue queue;    ///< The queued data
+	size_t capacity; ///< Maximum number of elements, or 0 if unbounded
+	int closed;      ///< Nonzero once *bqueue_close* has been called
+
+	pthread_mutex_t mutex;    ///< Guards every other field
+	pthread_cond_t not_empty; ///< Signalled when an element is enqueued
+	pthread_cond_t not_full;  ///< Signalled when an element is dequeued from a bounded queue
+
+	int waiting_consumers; ///< Number of threads waiting on `not_empty`
+	int waiting_producers; ///< Number of threads waiting on `not_full`
+
+} BQueue;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Queue Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * \brief Function to initialize a blocking queue
+ *
+ * \pre Must be called, and must return, before any thread uses the queue
+ *
+ * See *list_init* for the meaning of `destroy`.
+ *
+ * Complexity: O(1)
+ *
+ * \param queue    The queue to init
+ * \param destroy  Function pointer to free data element memory
+ * \param capacity Maximum number of elements in the queue, or 0 for no limit
+ *
+ * \return 0 if the queue was initialized, otherwise -1
+ */
+int
+bqueue_init(BQueue *queue, void (*destroy)(void *data), size_t capacity);
+
+/**
+ * \brief Function to destroy a blocking queue
+ *
+ * Calls the function passed as `destroy` to *bqueue_init* once for each element still in the
+ * queue, provided `destroy` was not set to NULL.
+ *
+ * \pre No other thread may be using or waiting on the queue; close it and join them first
+ *
+ * Complexity: O(n), or O(1) if `destroy` is NULL
+ *
+ * \param queue The queue to destroy
+ */
+void
+bqueue_destroy(BQueue *queue);
+
+/**
+ * \brief Function to close a blocking queue
+ *
+ * Every waiting thread is woken. From then on enqueues fail, while dequeues keep returning the
+ * elements already in the queue and fail once it is empty, so consumers can drain it and exit.
+ *
+ * Complexity: O(1)
+ *
+ * \param queue The queue to close
+ */
+void
+bqueue_close(BQueue *queue);
+
+/**
+ * \brief Function to add an element to the end of the queue, waiting while it is full
+ *
+ * Complexity: O(1) amortized
+ *
+ * \param queue The queue to add element to
+ * \param data  The data to enqueue
+ *
+ * \return 0 if enqueue operation was successful, or -1 if the queue is closed
+ */
+int
+bqueue_enqueue(BQueue *queue, const void *data);
+
+/**
+ * \brief Function to add an element to the end of the queue, waiting at most `timeout_ms`
+ *
+ * A timeout of 0 makes this a non-blocking attempt.
+ *
+ * Complexity: O(1) amortized
+ *
+ * \param queue      The queue to add element to
+ * \param data       The data to enqueue
+ * \param timeout_ms Maximum time to wait for room, in milliseconds
+ *
+ * \return 0 if enqueue operation was successful, or -1 if it timed out or the queue is closed
+ */
+int
+bqueue_enqueue_timed(BQueue *queue, const void *data, long timeout_ms);
+
+/**
+ * \brief Function to remove an element from the front of a queue, waiting while it is empty
+ *
+ * Complexity: O(1)
+ *
+ * \param queue The queue to remove element from
+ * \param data  The dequeued data
+ *
+ * \return 0 if dequeue operation was successful, or -1 if the queue is closed and empty
+ */
+int
+bqueue_dequeue(BQueue *queue, void **data);
+
+/**
+ * \brief Function to remove an element from the front of a queue, waiting at most `timeout_ms`
+ *
+ * A timeout of 0 makes this a non-blocking attempt. Use *bqueue_is_closed* to tell a timeout
+ * from a closed queue.
+ *
+ * Complexity: O(1)
+ *
+ * \param queue      The queue to remove element from
+ * \param data       The dequeued data
+ * \param timeout_ms Maximum time to wait for an element, in milliseconds
+ *
+ * \return 0 if dequeue operation was successful, or -1 if it timed out or the queue is closed
+ *         and empty
+ */
+int
+bqueue_dequeue_timed(BQueue *queue, void **data, long timeout_ms);
+
+/**
+ * \brief Function to add several elements to the end of the queue
+ *
+ * Takes the lock once and moves as many elements as fit each time it is woken, blocking while the
+ * queue is full, rather than taking the lock once per element.
+ *
+ * \param queue The queue to add elements to
+ * \param data  Array of `count` data to enqueue
+ * \param count Number of elements to enqueue
+ *
+ * \return Number of elements enqueued, which is less than `count` only if the queue was closed
+ */
+int
+bqueue_enqueue_n(BQueue *queue, void *const *data, int count);
+
+/**
+ * \brief Function to remove several elements from the front of a queue
+ *
+ * Blocks until at least one element is available, then takes up to `count` elements under the
+ * same lock hold.
+ *
+ * \param queue The queue to remove elements from
+ * \param data  Array of room for `count` dequeued data
+ * \param count Maximum number of elements to dequeue
+ *
+ * \return Number of elements dequeued, which is 0 only if the queue is closed and empty
+ */
+int
+bqueue_dequeue_n(BQueue *queue, void **data, int count);
+
+/**
+ * \brief Function to read the number of elements in the queue
+ *
+ * \return The number of elements, which other threads may change as soon as it is returned
+ */
+int
+bqueue_size(BQueue *queue);
+
+/**
+ * \brief Function to determine whether the queue has been closed
+ *
+ * \return 1 if *bqueue_close* has been called, otherwise 0
+ */
+int
+bqueue_is_closed(BQueue *queue);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // BQUEUE_h
@@ -19,20 +19,80 @@ clist_init(CList *list, void (*destroy)(void *data))
 {
 	// Initialize the list
 	list->size = 0;
+	list->match = NULL;
 	list->destroy = destroy;
 	list->head = NULL;
+	list->allocator = allocator_default;
+	list->element_size = 0;
+}
+
+void
+clist_init_inline(CList *list, void (*destroy)(void *data), size_t element_size,
+                  const Allocator *allocator)
+{
+	// Initialize the list, then size its elements for inline values
+	if (allocator != NULL) {
+		clist_init_allocator(list, destroy, allocator);
+	} else {
+		clist_init(list, destroy);
+	}
+
+	list->element_size = element_size;
+}
+
+void
+clist_init_allocator(CList *list, void (*destroy)(void *data), const Allocator *allocator)
+{
+	// Initialize the list, then attach the allocator
+	clist_init(list, destroy);
+	list->allocator = *allocator;
+}
+
+int
+clist_init_arena(CList *list, void (*destroy)(void *data), size_t slab_count)
+{
+	Allocator allocator;
+
+	if (pool_arena_allocator(&allocator, sizeof (CList_Element), slab_count, 0) != 0) {
+		return -1;
+	}
+
+	clist_init_allocator(list, destroy, &allocator);
+
+	return 0;
 }
 
 void
 clist_destroy(CList *list)
 {
+	CList_Element *element;
 	void *data;
+	int i;
+
+	if (list->allocator.release != NULL) {
+		// Elements go away with the arena, so only the data needs visiting
+		if (list->destroy != NULL) {
+			element = list->head;
+
+			for (i = 0; i < clist_size(list); i++) {
+				list->destroy(element->data);
+				element = element->next;
+			}
+		}
+
+		list->allocator.release(list->allocator.context);
+		memset(list, 0, sizeof (CList));
+		return;
+	}
 
-	// Remove each element in list
+	// Remove each element in list, destroying its data first since an inline value goes with it
 	while (clist_size(list) > 0) {
-		if (clist_remove_next(list, list->head, (void**)&data) == 0 && list->destroy != NULL) {
-			list->destroy(data);
+		if (list->destroy != NULL) {
+			list->destroy(clist_data(clist_next(list->head)));
 		}
+
+		data = NULL;
+		clist_remove_next(list, list->head, (void**)&data);
 	}
 
 	// No operations permitted at this point -- clear memory as precaution
@@ -45,12 +105,20 @@ clist_insert_next(CList *list, CList_Element *element, const void *data)
 	CList_Element *new_element;
 
 	// Allocate storage for the element
-	if ((new_element = (CList_Element*)malloc(sizeof (CList_Element))) == NULL) {
+	new_element = (CList_Element*)allocator_alloc(&list->allocator,
+	                                              sizeof (CList_Element) + list->element_size);
+
+	if (new_element == NULL) {
 		return -1;
 	}
 
-	// Insert the element into the linked-list
-	new_element->data = (void *)data;
+	// Insert the element into the linked-list, copying the value in if it is stored inline
+	if (list->element_size > 0) {
+		memcpy(new_element->value, data, list->element_size);
+		new_element->data = new_element->value;
+	} else {
+		new_element->data = (void *)data;
+	}
 
 	if (clist_size(list) == 0) {
 		// Insert into empty list
@@ -80,8 +148,6 @@ clist_remove_next(CList *list, CList_Element *element, void **data)
 		return -1;
 	}
 
-	*data = element->next->data;
-
 	if (element->next == element) {
 		// Remove the last element
 
@@ -98,11 +164,227 @@ clist_remove_next(CList *list, CList_Element *element, void **data)
 		}
 	}
 
+	// Hand over the data -- an inline value is copied out before its storage is freed
+	if (list->element_size == 0) {
+		*data = old_element->data;
+	} else if (*data != NULL) {
+		memcpy(*data, old_element->value, list->element_size);
+	}
+
 	// Free storage allocated by the abstract datatype
-	free(old_element);
+	allocator_free(&list->allocator, old_element, sizeof (CList_Element) + list->element_size);
 
 	// Adjust the size of the list
 	list->size--;
 
 	return 0;
-}
\ No newline at end of file
+}
+
+// Lists can only trade elements if they allocate them from the same place and at the same size,
+// and that place is not an arena, which belongs to exactly one list and is released with it
+static int
+same_storage(const CList *list, const CList *other)
+{
+	return list != other && allocator_same(&list->allocator, &other->allocator) &&
+	       list->allocator.release == NULL && list->element_size == other->element_size;
+}
+
+// Find the element before the head, which is the last one in list order
+static CList_Element *
+last_element(const CList *list)
+{
+	CList_Element *element = list->head;
+
+	while (element->next != list->head) {
+		element = element->next;
+	}
+
+	return element;
+}
+
+int
+clist_splice(CList *list, CList_Element *element, CList *other)
+{
+	CList_Element *last;
+
+	if (!same_storage(list, other)) {
+		return -1;
+	}
+
+	if (clist_size(other) == 0) {
+		return 0;
+	}
+
+	if (clist_size(list) == 0) {
+		// The ring of `other` becomes the ring of `list`
+		list->head = other->head;
+	} else {
+		// Open the ring of `other` before its head and link it in after `element`
+		last = last_element(other);
+		last->next = element->next;
+		element->next = other->head;
+	}
+
+	// Adjust the sizes
+	list->size += other->size;
+
+	other->size = 0;
+	other->head = NULL;
+
+	return 0;
+}
+
+int
+clist_concat(CList *list, CList *other)
+{
+	return clist_splice(list, clist_size(list) == 0 ? NULL : last_element(list), other);
+}
+
+int
+clist_split(CList *list, CList_Element *element, CList *other)
+{
+	CList_Element *first, *last;
+	int count;
+
+	if (!same_storage(list, other) || clist_size(other) != 0) {
+		return -1;
+	}
+
+	if (clist_size(list) == 0) {
+		return 0;
+	}
+
+	if (element == NULL) {
+		// The whole ring moves
+		other->head = list->head;
+		other->size = list->size;
+
+		list->head = NULL;
+		list->size = 0;
+
+		return 0;
+	}
+
+	first = element->next;
+
+	// Nothing follows the last element before the head
+	if (first == list->head) {
+		return 0;
+	}
+
+	for (count = 1, last = first; last->next != list->head; last = last->next) {
+		count++;
+	}
+
+	// Close both rings
+	element->next = list->head;
+	last->next = first;
+
+	list->size -= count;
+
+	other->head = first;
+	other->size = count;
+
+	return 0;
+}
+
+CList_Element *
+clist_find_next(const CList *list, CList_Element *element, const void *data)
+{
+	if (list->match == NULL || list->head == NULL) {
+		return NULL;
+	}
+
+	if (element == NULL) {
+		element = list->head;
+	} else if (element->next == list->head) {
+		// The last element before the head has nothing after it to search
+		return NULL;
+	} else {
+		element = element->next;
+	}
+
+	// Stop once the search gets back to the head
+	do {
+		if (list->match(data, element->data)) {
+			return element;
+		}
+
+		element = element->next;
+	} while (element != list->head);
+
+	return NULL;
+}
+
+CList_Element *
+clist_find(const CList *list, const void *data)
+{
+	return clist_find_next(list, NULL, data);
+}
+
+int
+clist_count(const CList *list, const void *data)
+{
+	CList_Element *element;
+	int count = 0, i;
+
+	if (list->match == NULL) {
+		return -1;
+	}
+
+	for (i = 0, element = list->head; i < clist_size(list); i++, element = element->next) {
+		count += list->match(data, element->data) != 0;
+	}
+
+	return count;
+}
+
+int
+clist_remove_matching(CList *list, const void *data)
+{
+	CList_Element *prev, *element;
+	int removed = 0, remaining;
+
+	if (list->match == NULL) {
+		return -1;
+	}
+
+	if (list->head == NULL) {
+		return 0;
+	}
+
+	// Visit each element once, starting at the head, always holding its predecessor
+	prev = last_element(list);
+
+	for (remaining = clist_size(list); remaining > 0; remaining--) {
+		element = prev->next;
+
+		if (!list->match(data, element->data)) {
+			prev = element;
+			continue;
+		}
+
+		// Unlink the element
+		if (element == prev) {
+			list->head = NULL;
+		} else {
+			prev->next = element->next;
+
+			if (element == list->head) {
+				list->head = element->next;
+			}
+		}
+
+		// Destroy the data, then free storage allocated by the abstract datatype
+		if (list->destroy != NULL) {
+			list->destroy(element->data);
+		}
+
+		allocator_free(&list->allocator, element, sizeof (CList_Element) + list->element_size);
+
+		list->size--;
+		removed++;
+	}
+
+	return removed;
+}
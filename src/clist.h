@@ -14,6 +14,9 @@ extern "C"
 {
 #endif
 
+#include "allocator.h"
+#include "pool.h"
+
 // -------------------------------------------------------------------------------------------------
 // Definitions
 // -------------------------------------------------------------------------------------------------
@@ -26,6 +29,8 @@ typedef struct CList_Element_s {
 	void *data;                   ///< Pointer to data
 	struct CList_Element_s *next; ///< Pointer to next element in list
 
+	unsigned char value[];        ///< Inline storage that `data` points to, if the list has any
+
 } CList_Element;
 
 /**
@@ -35,11 +40,14 @@ typedef struct CList_Element_s {
 typedef struct CList_s {
 	int size; ///< Number of elements in list
 
-	int (*match)(const void *a, const void *b);
-	void (*destroy)(void *data);
+	int (*match)(const void *a, const void *b); ///< Nonzero if data `b` matches key `a`, or NULL
+	void (*destroy)(void *data); ///< Function pointer to destroy element
 
 	CList_Element *head; ///< Pointer to first element in list
 
+	Allocator allocator; ///< Allocator used for element storage
+	size_t element_size; ///< Size of values stored inline in each element, or 0
+
 } CList;
 
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -56,6 +64,10 @@ typedef struct CList_s {
  * `destroy` should be set to *free* to free the data as the linked-list is destroyed. For a
  * circular linked-list containing data that should not be freed, `destroy` should be set to NULL.
  * 
+ * The list's `match` function starts out NULL, so *clist_find*, *clist_find_next*, *clist_count*
+ * and *clist_remove_matching* fail until one is set with *clist_set_match*. The other init
+ * functions behave the same way.
+ * 
  * Complexity: O(1)
  * 
  * \param list    The circular linked-list to init
@@ -64,6 +76,65 @@ typedef struct CList_s {
 void
 clist_init(CList *list, void (*destroy)(void *data));
 
+/**
+ * \brief Function to initialize a circular linked-list with a custom element allocator
+ * 
+ * \pre Must be called before list can be used by any other operation
+ * 
+ * Behaves like *clist_init*, except that element storage is obtained and released through
+ * `allocator` rather than *malloc* and *free*. The descriptor is copied into the list, but
+ * whatever its `context` refers to must outlive the list.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list      The circular linked-list to init
+ * \param destroy   Function pointer to free data element memory
+ * \param allocator The allocator to obtain element storage from
+ */
+void
+clist_init_allocator(CList *list, void (*destroy)(void *data), const Allocator *allocator);
+
+/**
+ * \brief Function to initialize a circular linked-list that stores fixed-size values inline
+ * 
+ * \pre Must be called before list can be used by any other operation
+ * 
+ * Each element copies `element_size` bytes from the `data` passed to *clist_insert_next* into
+ * storage trailing the element, and *clist_data* points at that copy. Upon *clist_remove_next*,
+ * the value is copied into the buffer that `*data` points to, or dropped if `*data` is NULL.
+ * See *list_init_inline* for details.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list         The circular linked-list to init
+ * \param destroy      Function pointer to release resources held by a value, or NULL
+ * \param element_size Size in bytes of each value (must be greater than 0)
+ * \param allocator    The allocator to obtain element storage from, or NULL for the default
+ */
+void
+clist_init_inline(CList *list, void (*destroy)(void *data), size_t element_size,
+                  const Allocator *allocator);
+
+/**
+ * \brief Function to initialize an arena-backed circular linked-list
+ * 
+ * \pre Must be called before list can be used by any other operation
+ * 
+ * The list allocates its elements from a private pool created by *pool_arena_allocator*.
+ * Elements removed while the list is in use are recycled by the pool, and *clist_destroy*
+ * releases all of them at once instead of freeing them one at a time.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list       The circular linked-list to init
+ * \param destroy    Function pointer to free data element memory
+ * \param slab_count Number of elements per arena slab, or 0 for POOL_DEFAULT_SLAB_COUNT
+ * 
+ * \return 0 if the arena was created, otherwise -1
+ */
+int
+clist_init_arena(CList *list, void (*destroy)(void *data), size_t slab_count);
+
 /**
  * \brief Function to destroy a circular linked-list
  * 
@@ -71,10 +142,14 @@ clist_init(CList *list, void (*destroy)(void *data));
  * function passed as `destroy` to *clist_init* once for each element as it is removed, provided
  * `destroy` was not set to NULL.
  * 
+ * If the list's allocator has a `release` function (e.g. a list set up by *clist_init_arena*),
+ * the elements are not freed individually: `destroy` is called for each element's data, if set,
+ * and the allocator is then released in one shot.
+ * 
  * \note
  * No operation is permitted after *clist_destroy* is called unless *clist_init* is called again.
  * 
- * Complexity: O(n)
+ * Complexity: O(n), or O(1) for an arena-backed list whose `destroy` is NULL
  * 
  * \param list The circular linked-list to destroy
  */
@@ -104,7 +179,9 @@ clist_insert_next(CList *list, CList_Element *element, const void *data);
  * \brief Function to remove an element from a circular linked list
  * 
  * Removes the element just past `element` from the circular linked-list. Upon return `data`
- * points to the data stored in the element that was removed.
+ * points to the data stored in the element that was removed. For a list set up by
+ * *clist_init_inline*, `*data` must instead point to a buffer the value is copied into (or be
+ * NULL to drop the value).
  * 
  * Complexity: O(1)
  * 
@@ -117,6 +194,133 @@ clist_insert_next(CList *list, CList_Element *element, const void *data);
 int
 clist_remove_next(CList *list, CList_Element *element, void **data);
 
+/**
+ * \brief Function to move every element of another list into a circular linked-list
+ * 
+ * Links the elements of `other` in just after `element` (which is ignored if `list` is empty),
+ * in their order starting from the head of `other`, by relinking pointers. No element is
+ * allocated, freed or copied, and `other` is left empty but initialized.
+ * 
+ * Both lists must allocate their elements from the same allocator and store the same inline
+ * size, since the moved elements are later freed by `list`. Arena-backed lists cannot trade
+ * elements, as each arena belongs to one list. The `destroy` function of `list` applies to the
+ * moved data from then on.
+ * 
+ * Complexity: O(m) where m is the size of `other`, since its last element has to be found
+ * 
+ * \param list    The circular linked-list to move elements into
+ * \param element Pointer to element to insert after
+ * \param other   The circular linked-list to take elements from
+ * 
+ * \return 0 if the elements were moved, or -1 if the lists' storage differs or they are the same
+ */
+int
+clist_splice(CList *list, CList_Element *element, CList *other);
+
+/**
+ * \brief Function to append every element of another circular linked-list to the end of one
+ * 
+ * Same as *clist_splice* after the last element of `list`.
+ * 
+ * Complexity: O(n + m), since the last elements of both lists have to be found
+ * 
+ * \param list  The circular linked-list to append to
+ * \param other The circular linked-list to take elements from
+ * 
+ * \return 0 if the elements were moved, or -1 if the lists' storage differs or they are the same
+ */
+int
+clist_concat(CList *list, CList *other);
+
+/**
+ * \brief Function to split a circular linked-list in two
+ * 
+ * Moves the elements from the one after `element` up to the last one before the head (every
+ * element if `element` is NULL) into `other` by relinking pointers, keeping their order. No
+ * element is allocated, freed or copied.
+ * 
+ * Complexity: O(n)
+ * 
+ * \param list    The circular linked-list to split
+ * \param element Pointer to element to split after, or NULL to move every element
+ * \param other   Empty circular linked-list with the same storage as `list`, to move elements into
+ * 
+ * \return 0 if the elements were moved, or -1 if `other` is not empty, its storage differs or
+ *         it is `list` itself
+ */
+int
+clist_split(CList *list, CList_Element *element, CList *other);
+
+/**
+ * \brief Function to find the first element whose data matches a key
+ * 
+ * Calls the `match` function set with *clist_set_match* as `match(data, element_data)` on each
+ * element from the head on, and stops at the first one for which it returns nonzero. Each step
+ * depends on loading the element before it, so on a list that does not fit in cache the search
+ * is bound by memory latency rather than by `match`.
+ * 
+ * Complexity: O(n)
+ * 
+ * \param list The circular linked-list to search
+ * \param data The key passed to `match`
+ * 
+ * \return The first matching element, or NULL if none matches or no `match` function is set
+ */
+CList_Element *
+clist_find(const CList *list, const void *data);
+
+/**
+ * \brief Function to find the next element whose data matches a key
+ * 
+ * Same as *clist_find*, but searches from the element after `element` (or from the head if
+ * `element` is NULL), stopping before the search would wrap around to the head again.
+ * 
+ * Complexity: O(n)
+ * 
+ * \param list    The circular linked-list to search
+ * \param element Pointer to element to search after
+ * \param data    The key passed to `match`
+ * 
+ * \return The next matching element, or NULL if none matches or no `match` function is set
+ */
+CList_Element *
+clist_find_next(const CList *list, CList_Element *element, const void *data);
+
+/**
+ * \brief Function to count the elements whose data matches a key
+ * 
+ * Complexity: O(n)
+ * 
+ * \param list The circular linked-list to search
+ * \param data The key passed to `match`
+ * 
+ * \return The number of matching elements, or -1 if no `match` function is set
+ */
+int
+clist_count(const CList *list, const void *data);
+
+/**
+ * \brief Function to remove every element whose data matches a key
+ * 
+ * Unlike *clist_remove_next*, the data of each removed element is not handed back;
+ * it is passed to the `destroy` function given at init, provided `destroy` was not set to NULL.
+ * 
+ * Complexity: O(n)
+ * 
+ * \param list The circular linked-list to remove elements from
+ * \param data The key passed to `match`
+ * 
+ * \return The number of elements removed, or -1 if no `match` function is set
+ */
+int
+clist_remove_matching(CList *list, const void *data);
+
+/**
+ * MACRO that sets the function used by *clist_find* and friends to compare a key with the data
+ * of an element; it returns nonzero if they match, otherwise 0
+ */
+#define clist_set_match(list, function) ((list)->match = (function))
+
 /**
  * MACRO that evaluates to the number of elements in the circular linked-list
  */
@@ -0,0 +1,110 @@
+/**
+ * \file cstack.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of a lock-free concurrent stack ADT
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include <string.h>
+
+#include "cstack.h"
+#include "hazard.h"
+#include "nodecache.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Stack Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+static void
+element_reclaim(void *element)
+{
+	allocator_free(&node_cache_allocator, element, sizeof (CStack_Element));
+}
+
+void
+cstack_init(CStack *stack, void (*destroy)(void *data))
+{
+	// Initialize the stack
+	atomic_init(&stack->head, NULL);
+	stack->destroy = destroy;
+}
+
+void
+cstack_destroy(CStack *stack)
+{
+	void *data;
+
+	// Remove each element, destroying its data
+	while (cstack_pop(stack, &data) == 0) {
+		if (stack->destroy != NULL) {
+			stack->destroy(data);
+		}
+	}
+
+	// Reclaim the popped elements right away where possible
+	hazard_collect();
+
+	// No operations permitted at this point -- clear memory as precaution
+	memset(stack, 0, sizeof (CStack));
+}
+
+int
+cstack_push(CStack *stack, const void *data)
+{
+	CStack_Element *new_element;
+
+	// Allocate storage for the element
+	if ((new_element = (CStack_Element *)allocator_alloc(&node_cache_allocator,
+	                                                     sizeof (CStack_Element))) == NULL) {
+		return -1;
+	}
+
+	new_element->data = (void *)data;
+	new_element->next = atomic_load_explicit(&stack->head, memory_order_relaxed);
+
+	// The element is private until the swap succeeds, so only the swap needs to publish it
+	while (!atomic_compare_exchange_weak_explicit(&stack->head, &new_element->next, new_element,
+	                                              memory_order_release, memory_order_relaxed)) {
+	}
+
+	return 0;
+}
+
+int
+cstack_pop(CStack *stack, void **data)
+{
+	CStack_Element *old_element;
+
+	for (;;) {
+		// Protect the top element, then make sure it is still the top
+		old_element = atomic_load(&stack->head);
+
+		if (old_element == NULL) {
+			hazard_clear(0);
+			return -1;
+		}
+
+		// Out of memory for a hazard record is not the same as an empty stack
+		if (hazard_set(0, old_element) != 0) {
+			return -2;
+		}
+
+		if (old_element != atomic_load(&stack->head)) {
+			continue;
+		}
+
+		// The element cannot be reclaimed now, so reading its next link is safe
+		if (atomic_compare_exchange_strong(&stack->head, &old_element, old_element->next)) {
+			break;
+		}
+	}
+
+	hazard_clear(0);
+
+	*data = old_element->data;
+
+	// Other threads may still be looking at the element
+	hazard_retire(old_element, element_reclaim);
+
+	return 0;
+}
@@ -0,0 +1,125 @@
+/**
+ * \file cstack.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Definitions of a lock-free concurrent stack ADT
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#ifndef CSTACK_h
+#define CSTACK_h
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdatomic.h>
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+/**
+ * \struct CStack_Element
+ * \brief Concurrent stack element
+ */
+typedef struct CStack_Element_s {
+	void *data;                    ///< Pointer to data
+
+	struct CStack_Element_s *next; ///< Pointer to element below in the stack
+
+} CStack_Element;
+
+/**
+ * \struct CStack
+ * \brief Lock-free stack safe for any number of threads (Treiber stack)
+ *
+ * Push and pop swing `head` with a single compare-and-swap. A popping thread protects the
+ * element it is about to unlink with a hazard pointer (see hazard.h), which is what makes the
+ * stack safe against ABA: an element cannot be reclaimed, and so cannot be handed out again and
+ * pushed back at the same address, while any thread still compares against it. Popped elements
+ * are retired to the hazard pointer domain and freed once no thread refers to them.
+ *
+ * Element storage comes from the per-thread node cache (see nodecache.h), so threads that push
+ * and pop in steady state rarely reach the global allocator.
+ */
+typedef struct CStack_s {
+	_Atomic(CStack_Element *) head; ///< Pointer to top element
+
+	void (*destroy)(void *data); ///< Function pointer to destroy element
+
+} CStack;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Stack Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * \brief Function to initialize a concurrent stack
+ *
+ * \pre Must be called, and must return, before any thread uses the stack
+ *
+ * See *list_init* for the meaning of `destroy`.
+ *
+ * Complexity: O(1)
+ *
+ * \param stack   The stack to init
+ * \param destroy Function pointer to free data element memory
+ */
+void
+cstack_init(CStack *stack, void (*destroy)(void *data));
+
+/**
+ * \brief Function to destroy a concurrent stack
+ *
+ * Pops every remaining element, calling the function passed as `destroy` to *cstack_init* on
+ * its data provided `destroy` was not set to NULL.
+ *
+ * \pre No other thread may be using the stack
+ *
+ * Complexity: O(n)
+ *
+ * \param stack The stack to destroy
+ */
+void
+cstack_destroy(CStack *stack);
+
+/**
+ * \brief Function to push an element to the top of the stack
+ *
+ * Complexity: O(1), lock-free
+ *
+ * \param stack The stack to push element onto
+ * \param data  The data to push
+ *
+ * \return 0 if stack push was successful, otherwise -1
+ */
+int
+cstack_push(CStack *stack, const void *data);
+
+/**
+ * \brief Function to pop an element off the top of the stack
+ *
+ * Complexity: O(1), lock-free
+ *
+ * \param stack The stack to pop the element from
+ * \param data  The data popped off the stack
+ *
+ * \return 0 if stack pop was successful, -1 if the stack is empty, or -2 if no hazard record
+ *         could be allocated for the calling thread (see *hazard_set*)
+ */
+int
+cstack_pop(CStack *stack, void **data);
+
+/**
+ * MACRO that determines whether the stack is empty
+ *
+ * There is no size counter, as keeping one would add a second contended atomic to every push
+ * and pop; with other threads operating on the stack the answer is only a snapshot.
+ */
+#define cstack_is_empty(stack) (atomic_load(&(stack)->head) == NULL ? 1 : 0)
+
+#ifdef __cplusplus
+}
+#endif
+#endif // CSTACK_h
@@ -0,0 +1,131 @@
+/**
+ * \file deque.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of a generic double-ended queue ADT
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "deque.h"
+#include "ring.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Deque Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+static int
+resize(Deque *deque, size_t capacity)
+{
+	return ring_resize(&deque->data, &deque->capacity, &deque->head, deque->size, capacity);
+}
+
+static int
+grow(Deque *deque)
+{
+	return resize(deque, deque->capacity == 0 ? DEQUE_DEFAULT_CAPACITY : deque->capacity * 2);
+}
+
+void
+deque_init(Deque *deque, void (*destroy)(void *data))
+{
+	// Initialize the deque
+	deque->size = 0;
+	deque->destroy = destroy;
+	deque->data = NULL;
+	deque->capacity = 0;
+	deque->head = 0;
+}
+
+void
+deque_destroy(Deque *deque)
+{
+	void *data;
+
+	// Destroy the data of each element, front of the deque first
+	if (deque->destroy != NULL) {
+		while (deque_pop_front(deque, &data) == 0) {
+			deque->destroy(data);
+		}
+	}
+
+	free(deque->data);
+
+	// No operations permitted at this point -- clear memory as precaution
+	memset(deque, 0, sizeof (Deque));
+}
+
+int
+deque_reserve(Deque *deque, size_t capacity)
+{
+	size_t rounded;
+
+	if (capacity <= deque->capacity) {
+		return 0;
+	}
+
+	if ((rounded = ring_round_capacity(capacity, DEQUE_DEFAULT_CAPACITY)) == 0) {
+		return -1;
+	}
+
+	return resize(deque, rounded);
+}
+
+int
+deque_push_front(Deque *deque, const void *data)
+{
+	// Double the buffer when it is full
+	if ((size_t)deque->size == deque->capacity && grow(deque) != 0) {
+		return -1;
+	}
+
+	deque->head = (deque->head - 1) & (deque->capacity - 1);
+	deque->data[deque->head] = (void *)data;
+	deque->size++;
+
+	return 0;
+}
+
+int
+deque_push_back(Deque *deque, const void *data)
+{
+	// Double the buffer when it is full
+	if ((size_t)deque->size == deque->capacity && grow(deque) != 0) {
+		return -1;
+	}
+
+	deque_at(deque, deque->size) = (void *)data;
+	deque->size++;
+
+	return 0;
+}
+
+int
+deque_pop_front(Deque *deque, void **data)
+{
+	// Do not allow removal from empty deque
+	if (deque->size == 0) {
+		return -1;
+	}
+
+	*data = deque->data[deque->head];
+	deque->head = (deque->head + 1) & (deque->capacity - 1);
+	deque->size--;
+
+	return 0;
+}
+
+int
+deque_pop_back(Deque *deque, void **data)
+{
+	// Do not allow removal from empty deque
+	if (deque->size == 0) {
+		return -1;
+	}
+
+	deque->size--;
+	*data = deque_at(deque, deque->size);
+
+	return 0;
+}
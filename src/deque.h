@@ -0,0 +1,216 @@
+/**
+ * \file deque.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Definitions of a generic double-ended queue ADT
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#ifndef DEQUE_h
+#define DEQUE_h
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+/**
+ * Number of slots allocated by the first push onto a deque that has no storage yet
+ */
+#define DEQUE_DEFAULT_CAPACITY 16
+
+/**
+ * \struct Deque
+ * \brief Generic double-ended queue holding its data pointers in a circular buffer
+ *
+ * Elements are addressed by their position from the front, 0 to size - 1, which stays O(1)
+ * since the buffer's capacity is a power of two and positions wrap with a mask. A full buffer is
+ * doubled and its elements are unwrapped into the new one.
+ */
+typedef struct Deque_s {
+	int size; ///< Number of elements in deque
+
+	void (*destroy)(void *data); ///< Function pointer to destroy element
+
+	void **data;     ///< Circular buffer of data pointers
+	size_t capacity; ///< Number of slots in `data` (0 or a power of two)
+	size_t head;     ///< Slot holding the front of the deque
+
+} Deque;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Deque Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * \brief Function to initialize a deque
+ *
+ * \pre Must be called before deque can be used by any other operation
+ *
+ * No storage is allocated until the first push (or *deque_reserve*). See *list_init* for the
+ * meaning of `destroy`.
+ *
+ * Complexity: O(1)
+ *
+ * \param deque   The deque to init
+ * \param destroy Function pointer to free data element memory
+ */
+void
+deque_init(Deque *deque, void (*destroy)(void *data));
+
+/**
+ * \brief Function to destroy a deque
+ *
+ * Calls the function passed as `destroy` to *deque_init* once for each element still in the
+ * deque, provided `destroy` was not set to NULL, and frees the buffer.
+ *
+ * \note
+ * No operation is permitted after *deque_destroy* is called unless *deque_init* is called again.
+ *
+ * Complexity: O(n), or O(1) if `destroy` is NULL
+ *
+ * \param deque The deque to destroy
+ */
+void
+deque_destroy(Deque *deque);
+
+/**
+ * \brief Function to reserve storage in a deque
+ *
+ * Grows the buffer so that it holds at least `capacity` elements, rounded up to a power of two.
+ * Never shrinks the buffer.
+ *
+ * Complexity: O(n)
+ *
+ * \param deque    The deque to reserve storage in
+ * \param capacity Number of elements to make room for
+ *
+ * \return 0 if the storage is available, otherwise -1
+ */
+int
+deque_reserve(Deque *deque, size_t capacity);
+
+/**
+ * \brief Function to add an element to the front of a deque
+ *
+ * Complexity: O(1) amortized
+ *
+ * \param deque The deque to add element to
+ * \param data  The data to push
+ *
+ * \return 0 if push was successful, otherwise -1
+ */
+int
+deque_push_front(Deque *deque, const void *data);
+
+/**
+ * \brief Function to add an element to the back of a deque
+ *
+ * Complexity: O(1) amortized
+ *
+ * \param deque The deque to add element to
+ * \param data  The data to push
+ *
+ * \return 0 if push was successful, otherwise -1
+ */
+int
+deque_push_back(Deque *deque, const void *data);
+
+/**
+ * \brief Function to remove an element from the front of a deque
+ *
+ * Complexity: O(1)
+ *
+ * \param deque The deque to remove element from
+ * \param data  The data removed
+ *
+ * \return 0 if pop was successful, otherwise -1
+ */
+int
+deque_pop_front(Deque *deque, void **data);
+
+/**
+ * \brief Function to remove an element from the back of a deque
+ *
+ * Complexity: O(1)
+ *
+ * \param deque The deque to remove element from
+ * \param data  The data removed
+ *
+ * \return 0 if pop was successful, otherwise -1
+ */
+int
+deque_pop_back(Deque *deque, void **data);
+
+/**
+ * MACRO that evaluates to the number of elements in the deque
+ */
+#define deque_size(deque) ((deque)->size)
+
+/**
+ * MACRO that evaluates to the number of elements the deque can hold without growing
+ */
+#define deque_capacity(deque) ((deque)->capacity)
+
+/**
+ * MACRO that evaluates to the data at position `index` from the front of the deque
+ *
+ * `index` must be in the range 0 to *deque_size* - 1.
+ */
+#define deque_at(deque, index) \
+	((deque)->data[((deque)->head + (size_t)(index)) & ((deque)->capacity - 1)])
+
+/**
+ * MACRO that provides mechanism to inspect the element at front of deque
+ */
+#define deque_peek_front(deque) ((deque)->size == 0 ? NULL : deque_at((deque), 0))
+
+/**
+ * MACRO that provides mechanism to inspect the element at back of deque
+ */
+#define deque_peek_back(deque) ((deque)->size == 0 ? NULL : deque_at((deque), (deque)->size - 1))
+
+/**
+ * MACRO that evaluates to the position of the front element of a deque, or -1 if it is empty
+ */
+#define deque_head(deque) ((deque)->size == 0 ? -1 : 0)
+
+/**
+ * MACRO that evaluates to the position of the back element of a deque, or -1 if it is empty
+ */
+#define deque_tail(deque) ((deque)->size - 1)
+
+/**
+ * MACRO that determines whether position is the front of deque
+ */
+#define deque_is_head(deque, index) ((index) == 0 ? 1 : 0)
+
+/**
+ * MACRO that determines whether position is the back of deque
+ */
+#define deque_is_tail(deque, index) ((index) == (deque)->size - 1 ? 1 : 0)
+
+/**
+ * MACRO that evaluates to the data stored at given position of a deque
+ */
+#define deque_data(deque, index) deque_at((deque), (index))
+
+/**
+ * MACRO that evaluates to the next position given a position in a deque, or -1 past the back
+ */
+#define deque_next(deque, index) ((index) + 1 < (deque)->size ? (index) + 1 : -1)
+
+/**
+ * MACRO that evaluates to the prev position given a position in a deque, or -1 before the front
+ */
+#define deque_prev(deque, index) ((index) - 1)
+
+#ifdef __cplusplus
+}
+#endif
+#endif // DEQUE_h
@@ -5,6 +5,7 @@
  * \version 0.1
  * \date 2023-05-11
  */
+#include <pthread.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -19,22 +20,91 @@ dlist_init(DList *list, void (*destroy)(void *data))
 {
 	// Initialize the list
 	list->size = 0;
+	list->match = NULL;
 	list->destroy = destroy;
 	list->head = NULL;
 	list->tail = NULL;
+	list->allocator = allocator_default;
+	list->element_size = 0;
+}
+
+void
+dlist_init_inline(DList *list, void (*destroy)(void *data), size_t element_size,
+                  const Allocator *allocator)
+{
+	// Initialize the list, then size its elements for inline values
+	if (allocator != NULL) {
+		dlist_init_allocator(list, destroy, allocator);
+	} else {
+		dlist_init(list, destroy);
+	}
+
+	list->element_size = element_size;
+}
+
+void
+dlist_init_allocator(DList *list, void (*destroy)(void *data), const Allocator *allocator)
+{
+	// Initialize the list, then attach the allocator
+	dlist_init(list, destroy);
+	list->allocator = *allocator;
+}
+
+int
+dlist_init_arena(DList *list, void (*destroy)(void *data), size_t slab_count)
+{
+	Allocator allocator;
+
+	if (pool_arena_allocator(&allocator, sizeof(DList_Element), slab_count, 0) != 0) {
+		return -1;
+	}
+
+	dlist_init_allocator(list, destroy, &allocator);
+
+	return 0;
+}
+
+int
+dlist_init_hugepage(DList *list, void (*destroy)(void *data))
+{
+	Allocator allocator;
+
+	if (pool_arena_allocator(&allocator, sizeof(DList_Element), 0, POOL_HUGEPAGE) != 0) {
+		return -1;
+	}
+
+	dlist_init_allocator(list, destroy, &allocator);
+
+	return 0;
 }
 
 void
 dlist_destroy(DList *list)
 {
+	DList_Element *element;
 	void *data;
 
-	// Remove each element in list
+	if (list->allocator.release != NULL) {
+		// Elements go away with the arena, so only the data needs visiting
+		if (list->destroy != NULL) {
+			for (element = list->head; element != NULL; element = element->next) {
+				list->destroy(element->data);
+			}
+		}
+
+		list->allocator.release(list->allocator.context);
+		memset(list, 0, sizeof(DList));
+		return;
+	}
+
+	// Remove each element in list, destroying its data first since an inline value goes with it
 	while (dlist_size(list) > 0) {
-		if (dlist_remove(list, dlist_tail(list), (void **)&data) == 0 &&
-		    list->destroy != NULL) {
-			list->destroy(data);
+		if (list->destroy != NULL) {
+			list->destroy(dlist_data(dlist_tail(list)));
 		}
+
+		data = NULL;
+		dlist_remove(list, dlist_tail(list), (void **)&data);
 	}
 
 	// No operations permitted a this point but clear memory as precaution
@@ -52,13 +122,19 @@ dlist_insert_next(DList *list, DList_Element *element, const void *data)
 	}
 
 	// Allocate storage for the element
-	if ((new_element = (DList_Element *)malloc(sizeof(DList_Element))) ==
-	    NULL) {
+	if ((new_element = (DList_Element *)allocator_alloc(&list->allocator,
+	                                                    sizeof(DList_Element) +
+	                                                    list->element_size)) == NULL) {
 		return -1;
 	}
 
-	// Insert the element into the linked-list
-	new_element->data = (void *)data;
+	// Insert the element into the linked-list, copying the value in if it is stored inline
+	if (list->element_size > 0) {
+		memcpy(new_element->value, data, list->element_size);
+		new_element->data = new_element->value;
+	} else {
+		new_element->data = (void *)data;
+	}
 
 	if (dlist_size(list) == 0) {
 		// Insert into empty list
@@ -99,13 +175,19 @@ dlist_insert_prev(DList *list, DList_Element *element, const void *data)
 	}
 
 	// Allocate storage for the element
-	if ((new_element = (DList_Element *)malloc(sizeof(DList_Element))) ==
-	    NULL) {
+	if ((new_element = (DList_Element *)allocator_alloc(&list->allocator,
+	                                                    sizeof(DList_Element) +
+	                                                    list->element_size)) == NULL) {
 		return -1;
 	}
 
-	// Insert the element into the linked-list
-	new_element->data = (void *)data;
+	// Insert the element into the linked-list, copying the value in if it is stored inline
+	if (list->element_size > 0) {
+		memcpy(new_element->value, data, list->element_size);
+		new_element->data = new_element->value;
+	} else {
+		new_element->data = (void *)data;
+	}
 
 	if (dlist_size(list) == 0) {
 		// Insert into empty list
@@ -145,8 +227,6 @@ dlist_remove(DList *list, DList_Element *element, void **data)
 
 	// Remove the element from the linked-list
 
-	*data = element->data;
-
 	if (element == list->head) {
 		// Remove from the head of the list
 
@@ -169,11 +249,386 @@ dlist_remove(DList *list, DList_Element *element, void **data)
 		}
 	}
 
+	// Hand over the data -- an inline value is copied out before its storage is freed
+	if (list->element_size == 0) {
+		*data = element->data;
+	} else if (*data != NULL) {
+		memcpy(*data, element->value, list->element_size);
+	}
+
 	// Free storage allocated by the abstract datatype
-	free(element);
+	allocator_free(&list->allocator, element, sizeof(DList_Element) + list->element_size);
 
 	// Adjust the size of the list
 	list->size--;
 
 	return 0;
-}
\ No newline at end of file
+}
+
+// Merge two sorted, NULL-terminated chains; `first` holds the earlier elements, so it wins ties
+static DList_Element *
+merge_runs(DList_Element *first, DList_Element *second, int (*compare)(const void *key1, const void *key2))
+{
+	DList_Element *head, **link = &head;
+
+	while (first != NULL && second != NULL) {
+		if (compare(first->data, second->data) <= 0) {
+			*link = first;
+			first = first->next;
+		} else {
+			*link = second;
+			second = second->next;
+		}
+
+		link = &(*link)->next;
+	}
+
+	*link = first != NULL ? first : second;
+
+	return head;
+}
+
+// Sort a NULL-terminated chain through its `next` links only and return its new head
+static DList_Element *
+sort_chain(DList_Element *element, int (*compare)(const void *key1, const void *key2))
+{
+	// runs[i] is NULL or a sorted chain of 2^i elements, all earlier than those in runs[i - 1]
+	DList_Element *runs[sizeof (int) * 8], *run, *next;
+	int used = 0, i;
+
+	// Feed the elements in one at a time, merging equal-sized runs like a binary counter carries;
+	// recently touched runs get merged while they are still in cache
+	for (; element != NULL; element = next) {
+		next = element->next;
+		element->next = NULL;
+		run = element;
+
+		for (i = 0; i < used && runs[i] != NULL; i++) {
+			run = merge_runs(runs[i], run, compare);
+			runs[i] = NULL;
+		}
+
+		if (i == used) {
+			used++;
+		}
+
+		runs[i] = run;
+	}
+
+	// Merge the leftover runs, smallest (latest) first
+	for (run = NULL, i = 0; i < used; i++) {
+		if (runs[i] != NULL) {
+			run = run == NULL ? runs[i] : merge_runs(runs[i], run, compare);
+		}
+	}
+
+	return run;
+}
+
+// Point the list at a sorted chain, rebuilding the prev links and finding the tail
+static void
+relink(DList *list, DList_Element *element)
+{
+	list->head = element;
+	element->prev = NULL;
+
+	while (element->next != NULL) {
+		element->next->prev = element;
+		element = element->next;
+	}
+
+	list->tail = element;
+}
+
+void
+dlist_sort(DList *list, int (*compare)(const void *key1, const void *key2))
+{
+	if (list->head != NULL) {
+		relink(list, sort_chain(list->head, compare));
+	}
+}
+
+typedef struct Sort_Task_s {
+	DList_Element *first;  ///< Chain to sort, or first of the two chains to merge
+	DList_Element *second; ///< Second chain to merge, or NULL when sorting
+	int (*compare)(const void *key1, const void *key2);
+
+} Sort_Task;
+
+static void *
+sort_task_run(void *arg)
+{
+	Sort_Task *task = (Sort_Task *)arg;
+
+	if (task->second == NULL) {
+		task->first = sort_chain(task->first, task->compare);
+	} else {
+		task->first = merge_runs(task->first, task->second, task->compare);
+	}
+
+	return NULL;
+}
+
+// Run tasks[0] .. tasks[count - 1] on their own threads and tasks[0] on the calling thread; a task
+// whose thread cannot be started is run inline instead
+static void
+sort_tasks_run(Sort_Task *tasks, int count)
+{
+	pthread_t threads[DLIST_SORT_MAX_THREADS];
+	int started[DLIST_SORT_MAX_THREADS];
+	int i;
+
+	for (i = 1; i < count; i++) {
+		if (!(started[i] = pthread_create(&threads[i], NULL, sort_task_run, &tasks[i]) == 0)) {
+			sort_task_run(&tasks[i]);
+		}
+	}
+
+	sort_task_run(&tasks[0]);
+
+	for (i = 1; i < count; i++) {
+		if (started[i]) {
+			pthread_join(threads[i], NULL);
+		}
+	}
+}
+
+void
+dlist_sort_parallel(DList *list, int (*compare)(const void *key1, const void *key2), int threads)
+{
+	Sort_Task tasks[DLIST_SORT_MAX_THREADS];
+	DList_Element *element;
+	int chunk, runs, i, j;
+
+	if (threads > DLIST_SORT_MAX_THREADS) {
+		threads = DLIST_SORT_MAX_THREADS;
+	}
+
+	// Small lists are not worth the threads
+	if (threads < 2 || dlist_size(list) < DLIST_SORT_PARALLEL_THRESHOLD) {
+		dlist_sort(list, compare);
+		return;
+	}
+
+	// Cut the list into one chain per thread; earlier chains hold earlier elements
+	chunk = dlist_size(list) / threads;
+	element = list->head;
+
+	for (i = 0; i < threads; i++) {
+		tasks[i].first = element;
+		tasks[i].second = NULL;
+		tasks[i].compare = compare;
+
+		if (i < threads - 1) {
+			for (j = 1; j < chunk; j++) {
+				element = element->next;
+			}
+
+			tasks[i + 1].first = element->next;
+			element->next = NULL;
+			element = tasks[i + 1].first;
+		}
+	}
+
+	sort_tasks_run(tasks, threads);
+
+	// Merge neighbouring chains pairwise, halving the number of chains each round; merging each
+	// earlier chain with the later one keeps the sort stable
+	for (runs = threads; runs > 1; runs = (runs + 1) / 2) {
+		for (i = 0; i < runs / 2; i++) {
+			tasks[i].first = tasks[2 * i].first;
+			tasks[i].second = tasks[2 * i + 1].first;
+		}
+
+		sort_tasks_run(tasks, runs / 2);
+
+		// An odd chain out moves up to the next round unchanged
+		if (runs % 2 == 1) {
+			tasks[runs / 2].first = tasks[runs - 1].first;
+		}
+	}
+
+	relink(list, tasks[0].first);
+}
+
+// Lists can only trade elements if they allocate them from the same place and at the same size,
+// and that place is not an arena, which belongs to exactly one list and is released with it
+static int
+same_storage(const DList *list, const DList *other)
+{
+	return list != other && allocator_same(&list->allocator, &other->allocator) &&
+	       list->allocator.release == NULL && list->element_size == other->element_size;
+}
+
+int
+dlist_splice(DList *list, DList_Element *element, DList *other)
+{
+	DList_Element *next;
+
+	if (!same_storage(list, other)) {
+		return -1;
+	}
+
+	if (dlist_size(other) == 0) {
+		return 0;
+	}
+
+	// Link the whole run of `other` in between `element` and the element after it
+	next = element == NULL ? list->head : element->next;
+
+	other->head->prev = element;
+	other->tail->next = next;
+
+	if (element == NULL) {
+		list->head = other->head;
+	} else {
+		element->next = other->head;
+	}
+
+	if (next == NULL) {
+		list->tail = other->tail;
+	} else {
+		next->prev = other->tail;
+	}
+
+	// Adjust the sizes
+	list->size += other->size;
+
+	other->size = 0;
+	other->head = NULL;
+	other->tail = NULL;
+
+	return 0;
+}
+
+int
+dlist_concat(DList *list, DList *other)
+{
+	return dlist_splice(list, dlist_tail(list), other);
+}
+
+int
+dlist_split(DList *list, DList_Element *element, DList *other)
+{
+	DList_Element *first, *last;
+	int count;
+
+	if (!same_storage(list, other) || dlist_size(other) != 0) {
+		return -1;
+	}
+
+	first = element == NULL ? list->head : element->next;
+
+	if (first == NULL) {
+		return 0;
+	}
+
+	// The run ends at the tail, but its length has to be counted
+	for (count = 1, last = first; last->next != NULL; last = last->next) {
+		count++;
+	}
+
+	// Cut the run off after `element`
+	if (element == NULL) {
+		list->head = NULL;
+	} else {
+		element->next = NULL;
+	}
+
+	first->prev = NULL;
+	list->tail = element;
+	list->size -= count;
+
+	other->head = first;
+	other->tail = last;
+	other->size = count;
+
+	return 0;
+}
+
+DList_Element *
+dlist_find_next(const DList *list, DList_Element *element, const void *data)
+{
+	if (list->match == NULL) {
+		return NULL;
+	}
+
+	element = element == NULL ? list->head : element->next;
+
+	while (element != NULL) {
+		if (list->match(data, element->data)) {
+			return element;
+		}
+
+		element = element->next;
+	}
+
+	return NULL;
+}
+
+DList_Element *
+dlist_find(const DList *list, const void *data)
+{
+	return dlist_find_next(list, NULL, data);
+}
+
+int
+dlist_count(const DList *list, const void *data)
+{
+	DList_Element *element;
+	int count = 0;
+
+	if (list->match == NULL) {
+		return -1;
+	}
+
+	for (element = list->head; element != NULL; element = element->next) {
+		count += list->match(data, element->data) != 0;
+	}
+
+	return count;
+}
+
+int
+dlist_remove_matching(DList *list, const void *data)
+{
+	DList_Element *element, *next;
+	int removed = 0;
+
+	if (list->match == NULL) {
+		return -1;
+	}
+
+	for (element = list->head; element != NULL; element = next) {
+		next = element->next;
+
+		if (!list->match(data, element->data)) {
+			continue;
+		}
+
+		// Unlink the element
+		if (element->prev == NULL) {
+			list->head = next;
+		} else {
+			element->prev->next = next;
+		}
+
+		if (next == NULL) {
+			list->tail = element->prev;
+		} else {
+			next->prev = element->prev;
+		}
+
+		// Destroy the data, then free storage allocated by the abstract datatype
+		if (list->destroy != NULL) {
+			list->destroy(element->data);
+		}
+
+		allocator_free(&list->allocator, element, sizeof (DList_Element) + list->element_size);
+
+		list->size--;
+		removed++;
+	}
+
+	return removed;
+}
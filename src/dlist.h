@@ -14,10 +14,23 @@ extern "C"
 {
 #endif
 
+#include "allocator.h"
+#include "pool.h"
+
 // -------------------------------------------------------------------------------------------------
 // Definitions
 // -------------------------------------------------------------------------------------------------
 
+/**
+ * Smallest list *dlist_sort_parallel* splits across threads; shorter lists are sorted serially
+ */
+#define DLIST_SORT_PARALLEL_THRESHOLD 65536
+
+/**
+ * Largest number of threads *dlist_sort_parallel* uses
+ */
+#define DLIST_SORT_MAX_THREADS 64
+
 /**
  * \struct DList_Element_s
  * \brief Generic doubly linked-list element
@@ -28,6 +41,8 @@ typedef struct DList_Element_s {
 	struct DList_Element_s *prev; ///< Pointer to prev element in list
 	struct DList_Element_s *next; ///< Pointer to next element in list
 
+	unsigned char value[];        ///< Inline storage that `data` points to, if the list has any
+
 } DList_Element;
 
 /**
@@ -37,13 +52,16 @@ typedef struct DList_Element_s {
 typedef struct DList_s {
 	int size; ///< Number of elements in list
 
-	// int (*match)(const void *a, const void *b);
+	int (*match)(const void *a, const void *b); ///< Nonzero if data `b` matches key `a`, or NULL
 
-	void (*destroy)(void *data);
+	void (*destroy)(void *data); ///< Function pointer to destroy element
 
 	DList_Element *head; ///< Pointer to first element in list
 	DList_Element *tail; ///< Pointer to last element in list
 
+	Allocator allocator; ///< Allocator used for element storage
+	size_t element_size; ///< Size of values stored inline in each element, or 0
+
 } DList;
 
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -61,6 +79,10 @@ typedef struct DList_s {
  * For a doubly linked-list containing data that should not be freed, `destroy` should be set to
  * NULL.
  * 
+ * The list's `match` function starts out NULL, so *dlist_find*, *dlist_find_next*, *dlist_count*
+ * and *dlist_remove_matching* fail until one is set with *dlist_set_match*. The other init
+ * functions behave the same way.
+ * 
  * Complexity: O(1)
  * 
  * \param list    The doubly linked-list to init
@@ -69,6 +91,84 @@ typedef struct DList_s {
 void 
 dlist_init(DList *list, void (*destroy)(void *data));
 
+/**
+ * \brief Function to initialize a doubly linked-list with a custom element allocator
+ * 
+ * \pre Must be called before list can be used by any other operation
+ * 
+ * Behaves like *dlist_init*, except that element storage is obtained and released through
+ * `allocator` rather than *malloc* and *free*. The descriptor is copied into the list, but
+ * whatever its `context` refers to must outlive the list.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list      The doubly linked-list to init
+ * \param destroy   Function pointer to free data element memory
+ * \param allocator The allocator to obtain element storage from
+ */
+void
+dlist_init_allocator(DList *list, void (*destroy)(void *data), const Allocator *allocator);
+
+/**
+ * \brief Function to initialize a doubly linked-list that stores fixed-size values inline
+ * 
+ * \pre Must be called before list can be used by any other operation
+ * 
+ * Each element copies `element_size` bytes from the `data` passed to *dlist_insert_next* or
+ * *dlist_insert_prev* into storage trailing the element, and *dlist_data* points at that copy.
+ * Upon *dlist_remove*, the value is copied into the buffer that `*data` points to, or dropped if
+ * `*data` is NULL. See *list_init_inline* for details.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list         The doubly linked-list to init
+ * \param destroy      Function pointer to release resources held by a value, or NULL
+ * \param element_size Size in bytes of each value (must be greater than 0)
+ * \param allocator    The allocator to obtain element storage from, or NULL for the default
+ */
+void
+dlist_init_inline(DList *list, void (*destroy)(void *data), size_t element_size,
+                  const Allocator *allocator);
+
+/**
+ * \brief Function to initialize an arena-backed doubly linked-list
+ * 
+ * \pre Must be called before list can be used by any other operation
+ * 
+ * The list allocates its elements from a private pool created by *pool_arena_allocator*.
+ * Elements removed while the list is in use are recycled by the pool, and *dlist_destroy*
+ * releases all of them at once instead of freeing them one at a time.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list       The doubly linked-list to init
+ * \param destroy    Function pointer to free data element memory
+ * \param slab_count Number of elements per arena slab, or 0 for POOL_DEFAULT_SLAB_COUNT
+ * 
+ * \return 0 if the arena was created, otherwise -1
+ */
+int
+dlist_init_arena(DList *list, void (*destroy)(void *data), size_t slab_count);
+
+/**
+ * \brief Function to initialize a doubly linked-list backed by a huge page arena
+ * 
+ * \pre Must be called before list can be used by any other operation
+ * 
+ * Like *dlist_init_arena*, but the arena's slabs are 2MB huge pages (see POOL_HUGEPAGE), so
+ * elements of a very large list are packed into few pages and traversal incurs far fewer TLB
+ * misses. Falls back to normal pages when huge pages are unavailable.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list    The doubly linked-list to init
+ * \param destroy Function pointer to free data element memory
+ * 
+ * \return 0 if the arena was created, otherwise -1
+ */
+int
+dlist_init_hugepage(DList *list, void (*destroy)(void *data));
+
 /**
  * \brief Function to destroy a doubly linked-list
  * 
@@ -76,10 +176,14 @@ dlist_init(DList *list, void (*destroy)(void *data));
  * function passed as `destroy` to *dlist_init* once for each element as it is removed, provided
  * `destroy` was not set to NULL.
  * 
+ * If the list's allocator has a `release` function (e.g. a list set up by *dlist_init_arena*),
+ * the elements are not freed individually: `destroy` is called for each element's data, if set,
+ * and the allocator is then released in one shot.
+ * 
  * \note
  * No operation is permitted after *dlist_destroy* is called unless *dlist_init* is called again.
  * 
- * Complexity: O(n)
+ * Complexity: O(n), or O(1) for an arena-backed list whose `destroy` is NULL
  * 
  * \param list The doubly linked-list to destroy
  */
@@ -127,7 +231,9 @@ dlist_insert_prev(DList *list, DList_Element *element, const void *data);
  * \brief Function to remove an element from a doubly linked-list
  * 
  * Removes the element specified as `element` from the doubly linked-list. Upon return `data`
- * points to the data stored in the element that was removed.
+ * points to the data stored in the element that was removed. For a list set up by
+ * *dlist_init_inline*, `*data` must instead point to a buffer the value is copied into (or be
+ * NULL to drop the value).
  * 
  * Complexity: O(1)
  * 
@@ -140,6 +246,171 @@ dlist_insert_prev(DList *list, DList_Element *element, const void *data);
 int
 dlist_remove(DList *list, DList_Element *element, void **data);
 
+/**
+ * \brief Function to sort a doubly linked-list in place
+ * 
+ * Sorts the elements into ascending order as defined by `compare` by relinking the existing
+ * elements with a bottom-up merge sort. No element is allocated, freed or moved in memory, so
+ * pointers to elements and to their data stay valid. The sort is stable: elements that compare
+ * equal keep their relative order. Both the `next` and `prev` links
+ * are rebuilt.
+ * 
+ * Complexity: O(n log n) comparisons, O(1) extra memory
+ * 
+ * \param list    The doubly linked-list to sort
+ * \param compare Function returning less than, equal to or greater than 0 when the data `key1`
+ *                is less than, equal to or greater than the data `key2` (as for *qsort*)
+ */
+void
+dlist_sort(DList *list, int (*compare)(const void *key1, const void *key2));
+
+/**
+ * \brief Function to sort a doubly linked-list in place using several threads
+ * 
+ * Produces the same order as *dlist_sort*, relinking the existing elements without allocating,
+ * freeing or moving them. The list is cut into `threads` chains, which are sorted concurrently
+ * and then merged pairwise, concurrently, until one chain is left. Lists shorter than
+ * DLIST_SORT_PARALLEL_THRESHOLD, or a `threads` below 2, take the serial *dlist_sort* path.
+ * 
+ * \note
+ * Cutting the list, the final merge and rebuilding the `prev` links are each a serial pass over
+ * all elements, which bounds the speedup. `compare` is called from several threads at once.
+ * 
+ * Complexity: O(n log n) comparisons, O(threads) extra memory
+ * 
+ * \param list    The doubly linked-list to sort
+ * \param compare Function comparing two data, as for *dlist_sort*
+ * \param threads Number of threads to use, capped at DLIST_SORT_MAX_THREADS
+ */
+void
+dlist_sort_parallel(DList *list, int (*compare)(const void *key1, const void *key2), int threads);
+
+/**
+ * \brief Function to move every element of another list into a doubly linked-list
+ * 
+ * Links the elements of `other` in just after `element` (or at the head if `element` is NULL), in
+ * their order in `other`, by relinking pointers. No element is allocated, freed or copied, and
+ * `other` is left empty but initialized.
+ * 
+ * Both lists must allocate their elements from the same allocator and store the same inline
+ * size, since the moved elements are later freed by `list`. Arena-backed lists cannot trade
+ * elements, as each arena belongs to one list. The `destroy` function of `list` applies to the
+ * moved data from then on.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list    The doubly linked-list to move elements into
+ * \param element Pointer to element to insert after
+ * \param other   The doubly linked-list to take elements from
+ * 
+ * \return 0 if the elements were moved, or -1 if the lists' storage differs or they are the same
+ */
+int
+dlist_splice(DList *list, DList_Element *element, DList *other);
+
+/**
+ * \brief Function to append every element of another list to a doubly linked-list
+ * 
+ * Same as *dlist_splice* after the last element of `list`.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list  The doubly linked-list to append to
+ * \param other The doubly linked-list to take elements from
+ * 
+ * \return 0 if the elements were moved, or -1 if the lists' storage differs or they are the same
+ */
+int
+dlist_concat(DList *list, DList *other);
+
+/**
+ * \brief Function to split a doubly linked-list in two
+ * 
+ * Moves the elements after `element` (every element if `element` is NULL) into `other` by
+ * relinking pointers, keeping their order. No element is allocated, freed or copied.
+ * 
+ * Complexity: O(k) where k is the number of elements moved, which have to be counted
+ * 
+ * \param list    The doubly linked-list to split
+ * \param element Pointer to element to split after, or NULL to move every element
+ * \param other   Empty doubly linked-list with the same storage as `list`, to move elements into
+ * 
+ * \return 0 if the elements were moved, or -1 if `other` is not empty, its storage differs or
+ *         it is `list` itself
+ */
+int
+dlist_split(DList *list, DList_Element *element, DList *other);
+
+/**
+ * \brief Function to find the first element whose data matches a key
+ * 
+ * Calls the `match` function set with *dlist_set_match* as `match(data, element_data)` on each
+ * element from the head on, and stops at the first one for which it returns nonzero. Each step
+ * depends on loading the element before it, so on a list that does not fit in cache the search
+ * is bound by memory latency rather than by `match`.
+ * 
+ * Complexity: O(n)
+ * 
+ * \param list The doubly linked-list to search
+ * \param data The key passed to `match`
+ * 
+ * \return The first matching element, or NULL if none matches or no `match` function is set
+ */
+DList_Element *
+dlist_find(const DList *list, const void *data);
+
+/**
+ * \brief Function to find the next element whose data matches a key
+ * 
+ * Same as *dlist_find*, but searches from the element after `element` (or from the head if
+ * `element` is NULL).
+ * 
+ * Complexity: O(n)
+ * 
+ * \param list    The doubly linked-list to search
+ * \param element Pointer to element to search after
+ * \param data    The key passed to `match`
+ * 
+ * \return The next matching element, or NULL if none matches or no `match` function is set
+ */
+DList_Element *
+dlist_find_next(const DList *list, DList_Element *element, const void *data);
+
+/**
+ * \brief Function to count the elements whose data matches a key
+ * 
+ * Complexity: O(n)
+ * 
+ * \param list The doubly linked-list to search
+ * \param data The key passed to `match`
+ * 
+ * \return The number of matching elements, or -1 if no `match` function is set
+ */
+int
+dlist_count(const DList *list, const void *data);
+
+/**
+ * \brief Function to remove every element whose data matches a key
+ * 
+ * Unlike *dlist_remove*, the data of each removed element is not handed back;
+ * it is passed to the `destroy` function given at init, provided `destroy` was not set to NULL.
+ * 
+ * Complexity: O(n)
+ * 
+ * \param list The doubly linked-list to remove elements from
+ * \param data The key passed to `match`
+ * 
+ * \return The number of elements removed, or -1 if no `match` function is set
+ */
+int
+dlist_remove_matching(DList *list, const void *data);
+
+/**
+ * MACRO that sets the function used by *dlist_find* and friends to compare a key with the data
+ * of an element; it returns nonzero if they match, otherwise 0
+ */
+#define dlist_set_match(list, function) ((list)->match = (function))
+
 /**
  * MACRO that evaluates to the number of elements in the doubly linked-list
  */
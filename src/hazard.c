@@ -0,0 +1,244 @@
+/**
+ * \file hazard.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of hazard pointers for safe memory reclamation in lock-free ADTs
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+
+#include "hazard.h"
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+static _Atomic(Hazard_Record *) records = NULL;
+static atomic_size_t record_count = 0;
+
+static _Thread_local Hazard_Record *record = NULL;
+
+static pthread_key_t record_key;
+static pthread_once_t record_key_once = PTHREAD_ONCE_INIT;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Hazard Pointer Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+static int
+compare_pointers(const void *a, const void *b)
+{
+	const char *pa = *(char *const *)a;
+	const char *pb = *(char *const *)b;
+
+	return (pa > pb) - (pa < pb);
+}
+
+static void
+record_scan(Hazard_Record *owned)
+{
+	Hazard_Record *head, *other;
+	void **hazards;
+	size_t count = 0, capacity, kept = 0, i;
+	int slot;
+
+	// Records are counted before they are linked in, so the count covers every record reachable
+	// from the head loaded first
+	head = atomic_load(&records);
+	capacity = atomic_load(&record_count) * HAZARD_SLOTS;
+
+	if ((hazards = (void **)malloc(capacity * sizeof (void *))) == NULL) {
+		return;
+	}
+
+	// Snapshot every published hazard pointer
+	for (other = head; other != NULL && count < capacity; other = other->next) {
+		for (slot = 0; slot < HAZARD_SLOTS && count < capacity; slot++) {
+			if ((hazards[count] = atomic_load(&other->slots[slot])) != NULL) {
+				count++;
+			}
+		}
+	}
+
+	qsort(hazards, count, sizeof (void *), compare_pointers);
+
+	// Reclaim the retired blocks nobody refers to and keep the rest
+	for (i = 0; i < owned->retired_count; i++) {
+		if (bsearch(&owned->retired[i].ptr, hazards, count, sizeof (void *), compare_pointers) != NULL) {
+			owned->retired[kept++] = owned->retired[i];
+		} else {
+			owned->retired[i].reclaim(owned->retired[i].ptr);
+		}
+	}
+
+	owned->retired_count = kept;
+
+	free(hazards);
+}
+
+static int
+is_hazard(void *ptr)
+{
+	Hazard_Record *other;
+	int slot;
+
+	for (other = atomic_load(&records); other != NULL; other = other->next) {
+		for (slot = 0; slot < HAZARD_SLOTS; slot++) {
+			if (atomic_load(&other->slots[slot]) == ptr) {
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static void
+record_release(void *owned)
+{
+	Hazard_Record *released = (Hazard_Record *)owned;
+	int slot;
+
+	for (slot = 0; slot < HAZARD_SLOTS; slot++) {
+		atomic_store(&released->slots[slot], NULL);
+	}
+
+	record_scan(released);
+
+	// Leftovers stay on the record for the next thread that takes it over
+	atomic_store(&released->active, 0);
+	record = NULL;
+}
+
+static void
+record_key_create(void)
+{
+	pthread_key_create(&record_key, record_release);
+}
+
+static Hazard_Record *
+record_acquire(void)
+{
+	Hazard_Record *candidate, *head;
+	int inactive, slot;
+
+	// Take over a record given up by a thread that exited
+	for (candidate = atomic_load(&records); candidate != NULL; candidate = candidate->next) {
+		inactive = 0;
+
+		if (atomic_load(&candidate->active) == 0 &&
+		    atomic_compare_exchange_strong(&candidate->active, &inactive, 1)) {
+			break;
+		}
+	}
+
+	// Otherwise append a new one
+	if (candidate == NULL) {
+		if ((candidate = (Hazard_Record *)malloc(sizeof (Hazard_Record))) == NULL) {
+			return NULL;
+		}
+
+		for (slot = 0; slot < HAZARD_SLOTS; slot++) {
+			atomic_init(&candidate->slots[slot], NULL);
+		}
+
+		atomic_init(&candidate->active, 1);
+		candidate->retired = NULL;
+		candidate->retired_count = 0;
+		candidate->retired_capacity = 0;
+
+		// Count the record first, see record_scan
+		atomic_fetch_add(&record_count, 1);
+
+		head = atomic_load(&records);
+
+		do {
+			candidate->next = head;
+		} while (!atomic_compare_exchange_weak(&records, &head, candidate));
+	}
+
+	// Make sure the record is given up when this thread exits
+	pthread_once(&record_key_once, record_key_create);
+	pthread_setspecific(record_key, candidate);
+
+	return candidate;
+}
+
+int
+hazard_set(int slot, void *ptr)
+{
+	if (record == NULL && (record = record_acquire()) == NULL) {
+		return -1;
+	}
+
+	// Sequentially consistent so the store is visible before the caller re-reads the source;
+	// clearing only has to be ordered after the caller's last use of the block
+	if (ptr != NULL) {
+		atomic_store(&record->slots[slot], ptr);
+	} else {
+		atomic_store_explicit(&record->slots[slot], NULL, memory_order_release);
+	}
+
+	return 0;
+}
+
+void
+hazard_retire(void *ptr, void (*reclaim)(void *ptr))
+{
+	Hazard_Retired *retired;
+	size_t capacity, threshold;
+
+	if (record == NULL && (record = record_acquire()) == NULL) {
+		// Without a record nothing can be deferred, so wait until the block is safe
+		while (is_hazard(ptr)) {
+			sched_yield();
+		}
+
+		reclaim(ptr);
+		return;
+	}
+
+	// Grow the retired list, or make room by scanning until some blocks can be reclaimed
+	while (record->retired_count == record->retired_capacity) {
+		capacity = record->retired_capacity == 0 ? HAZARD_RETIRE_THRESHOLD
+		                                         : record->retired_capacity * 2;
+
+		if ((retired = (Hazard_Retired *)realloc(record->retired,
+		                                         capacity * sizeof (Hazard_Retired))) != NULL) {
+			record->retired = retired;
+			record->retired_capacity = capacity;
+			break;
+		}
+
+		record_scan(record);
+
+		if (record->retired_count == record->retired_capacity) {
+			sched_yield();
+		}
+	}
+
+	record->retired[record->retired_count].ptr = ptr;
+	record->retired[record->retired_count].reclaim = reclaim;
+	record->retired_count++;
+
+	// Scan once the list is well past the number of hazard pointers that could pin it
+	threshold = 2 * atomic_load(&record_count) * HAZARD_SLOTS;
+
+	if (threshold < HAZARD_RETIRE_THRESHOLD) {
+		threshold = HAZARD_RETIRE_THRESHOLD;
+	}
+
+	if (record->retired_count >= threshold) {
+		record_scan(record);
+	}
+}
+
+void
+hazard_collect(void)
+{
+	if (record != NULL) {
+		record_scan(record);
+	}
+}
@@ -0,0 +1,124 @@
+/**
+ * \file hazard.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Definitions of hazard pointers for safe memory reclamation in lock-free ADTs
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#ifndef HAZARD_h
+#define HAZARD_h
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+/**
+ * Number of hazard pointers each thread may hold at once
+ */
+#define HAZARD_SLOTS 2
+
+/**
+ * Minimum number of retired blocks a thread collects before scanning for ones it may reclaim
+ */
+#define HAZARD_RETIRE_THRESHOLD 64
+
+/**
+ * \struct Hazard_Retired
+ * \brief Block waiting until no hazard pointer refers to it
+ */
+typedef struct Hazard_Retired_s {
+	void *ptr;                  ///< The retired block
+	void (*reclaim)(void *ptr); ///< Function that releases the block
+
+} Hazard_Retired;
+
+/**
+ * \struct Hazard_Record
+ * \brief A thread's hazard pointers and retired blocks
+ *
+ * Records are never freed; a thread takes over an unused record (and whatever blocks were left
+ * retired on it) or appends a new one to the global chain, and gives it up when it exits.
+ */
+typedef struct Hazard_Record_s {
+	_Atomic(void *) slots[HAZARD_SLOTS]; ///< Blocks the owning thread may be dereferencing
+	atomic_int active;                   ///< Nonzero while the record is owned by a thread
+
+	struct Hazard_Record_s *next;        ///< Pointer to next record in the global chain
+
+	Hazard_Retired *retired;             ///< Blocks retired by the owning thread
+	size_t retired_count;                ///< Number of entries in `retired`
+	size_t retired_capacity;             ///< Number of slots in `retired`
+
+} Hazard_Record;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Hazard Pointer Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * \brief Function to announce that the calling thread is about to dereference a block
+ *
+ * A block published in a hazard slot will not be reclaimed by *hazard_retire* from any thread.
+ * Publishing is not enough on its own: the caller must then re-read the shared location it
+ * loaded `ptr` from, and only rely on `ptr` if it is still there, since the block could have
+ * been retired in between. For example:
+ *
+ *     do {
+ *         top = atomic_load(&stack->head);
+ *         hazard_set(0, top);
+ *     } while (top != atomic_load(&stack->head));
+ *
+ * Complexity: O(1)
+ *
+ * \param slot Index of the hazard slot, less than HAZARD_SLOTS
+ * \param ptr  The block to protect, or NULL to clear the slot
+ *
+ * \return 0 if the slot was set, or -1 if no record could be allocated for the thread
+ */
+int
+hazard_set(int slot, void *ptr);
+
+/**
+ * \brief Function to hand a block that has been unlinked from a shared ADT over for reclaiming
+ *
+ * The block is kept on the calling thread's retired list until no thread holds a hazard pointer
+ * to it, then `reclaim` is called on it. Lists are scanned once they reach a threshold that
+ * grows with the number of hazard pointers, so the cost of a scan is amortized over many
+ * retired blocks.
+ *
+ * Complexity: O(1) amortized
+ *
+ * \param ptr     The block to retire
+ * \param reclaim Function that releases the block, e.g. *free*
+ */
+void
+hazard_retire(void *ptr, void (*reclaim)(void *ptr));
+
+/**
+ * \brief Function to reclaim every block retired by the calling thread that is no longer hazardous
+ *
+ * Runs a scan regardless of the threshold. Threads scan automatically when they exit, and any
+ * blocks still protected at that point are taken over by the next thread that uses the record.
+ *
+ * Complexity: O(r log h) where r is the number of retired blocks and h of hazard pointers
+ */
+void
+hazard_collect(void);
+
+/**
+ * MACRO to clear a hazard slot of the calling thread once it no longer dereferences the block
+ */
+#define hazard_clear(slot) hazard_set((slot), NULL)
+
+#ifdef __cplusplus
+}
+#endif
+#endif // HAZARD_h
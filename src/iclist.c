@@ -0,0 +1,80 @@
+/**
+ * \file iclist.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of an intrusive circular linked-list ADT
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include "iclist.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// List Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void
+iclist_init(ICList *list)
+{
+	// Initialize the list
+	list->size = 0;
+	list->head = NULL;
+}
+
+int
+iclist_insert_next(ICList *list, ICList_Link *link, ICList_Link *new_link)
+{
+	if (new_link == NULL) {
+		return -1;
+	}
+
+	if (iclist_size(list) == 0) {
+		// Insert into empty list
+
+		new_link->next = new_link;
+		list->head = new_link;
+	} else {
+		// Insert into a non-empty list
+
+		new_link->next = link->next;
+		link->next = new_link;
+	}
+
+	// Adjust the size
+	list->size++;
+
+	return 0;
+}
+
+int
+iclist_remove_next(ICList *list, ICList_Link *link, ICList_Link **removed)
+{
+	ICList_Link *old_link;
+
+	// Check for empty list!
+	if (iclist_size(list) == 0) {
+		return -1;
+	}
+
+	old_link = link->next;
+
+	if (old_link == link) {
+		// Remove the last link
+
+		list->head = NULL;
+	} else {
+		// Remove a link other than the last link
+
+		link->next = old_link->next;
+
+		if (old_link == iclist_head(list)) {
+			list->head = old_link->next;
+		}
+	}
+
+	old_link->next = NULL;
+	*removed = old_link;
+
+	// Adjust the size of the list
+	list->size--;
+
+	return 0;
+}
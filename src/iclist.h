@@ -0,0 +1,122 @@
+/**
+ * \file iclist.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Definitions of an intrusive circular linked-list ADT
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#ifndef ICLIST_h
+#define ICLIST_h
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+/**
+ * \struct ICList_Link
+ * \brief Link embedded in each object stored in an intrusive circular linked-list
+ *
+ * The caller embeds an ICList_Link member in its own struct and passes a pointer to it, so the
+ * list never allocates; *iclist_entry* recovers the enclosing object from a link.
+ */
+typedef struct ICList_Link_s {
+	struct ICList_Link_s *next; ///< Pointer to next link in list
+
+} ICList_Link;
+
+/**
+ * \struct ICList
+ * \brief Intrusive circular linked-list
+ */
+typedef struct ICList_s {
+	int size; ///< Number of links in list
+
+	ICList_Link *head; ///< Pointer to first link in list
+
+} ICList;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// List Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * \brief Function to initialize an intrusive circular linked-list
+ * 
+ * \pre Must be called before list can be used by any other operation
+ * 
+ * The list does not own the objects linked into it, so there is no `destroy` callback and no
+ * destroy operation.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list The intrusive circular linked-list to init
+ */
+void
+iclist_init(ICList *list);
+
+/**
+ * \brief Function to link an object into an intrusive circular linked-list
+ * 
+ * Links `new_link` just after `link`. When inserting into an empty list, `link` should be NULL,
+ * and `new_link` becomes the head of the list. `new_link` must not currently be linked into
+ * any list.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list     The intrusive circular linked-list to insert into
+ * \param link     Pointer to link to insert after
+ * \param new_link The link embedded in the object to insert
+ * 
+ * \return 0 if inserting into list was successful, otherwise -1
+ */
+int
+iclist_insert_next(ICList *list, ICList_Link *link, ICList_Link *new_link);
+
+/**
+ * \brief Function to unlink an object from an intrusive circular linked-list
+ * 
+ * Unlinks the link just past `link`. Upon return `removed` points to the unlinked link; the
+ * object containing it is not freed.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list    The intrusive circular linked-list to remove from
+ * \param link    Pointer to link to remove after
+ * \param removed The link removed
+ * 
+ * \return 0 if removing from list was successful, otherwise -1
+ */
+int
+iclist_remove_next(ICList *list, ICList_Link *link, ICList_Link **removed);
+
+/**
+ * MACRO that evaluates to the object of `type` whose `member` is the given link
+ */
+#define iclist_entry(link, type, member) ((type *)((char *)(link) - offsetof(type, member)))
+
+/**
+ * MACRO that evaluates to the number of links in the intrusive circular linked-list
+ */
+#define iclist_size(list) ((list)->size)
+
+/**
+ * MACRO that evaluates to the link at the head of an intrusive circular linked-list
+ */
+#define iclist_head(list) ((list)->head)
+
+/**
+ * MACRO that evaluates to the next link given a link in an intrusive circular linked-list
+ */
+#define iclist_next(link) ((link)->next)
+
+#ifdef __cplusplus
+}
+#endif
+#endif // ICLIST_h
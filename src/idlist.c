@@ -0,0 +1,132 @@
+/**
+ * \file idlist.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of an intrusive doubly linked-list ADT
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include "idlist.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// List Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void
+idlist_init(IDList *list)
+{
+	// Initialize the list
+	list->size = 0;
+	list->head = NULL;
+	list->tail = NULL;
+}
+
+int
+idlist_insert_next(IDList *list, IDList_Link *link, IDList_Link *new_link)
+{
+	// Do not allow a NULL link unless the list is empty
+	if (new_link == NULL || (link == NULL && idlist_size(list) != 0)) {
+		return -1;
+	}
+
+	if (idlist_size(list) == 0) {
+		// Insert into empty list
+
+		list->head = new_link;
+		list->head->prev = NULL;
+		list->head->next = NULL;
+		list->tail = new_link;
+	} else {
+		// Insert into non-empty list
+
+		new_link->next = link->next;
+		new_link->prev = link;
+
+		if (link->next == NULL) {
+			list->tail = new_link;
+		} else {
+			link->next->prev = new_link;
+		}
+
+		link->next = new_link;
+	}
+
+	// Adjust the size
+	list->size++;
+
+	return 0;
+}
+
+int
+idlist_insert_prev(IDList *list, IDList_Link *link, IDList_Link *new_link)
+{
+	// Do not allow a NULL link unless the list is empty
+	if (new_link == NULL || (link == NULL && idlist_size(list) != 0)) {
+		return -1;
+	}
+
+	if (idlist_size(list) == 0) {
+		// Insert into empty list
+
+		list->head = new_link;
+		list->head->prev = NULL;
+		list->head->next = NULL;
+		list->tail = new_link;
+	} else {
+		// Insert into non-empty list
+
+		new_link->next = link;
+		new_link->prev = link->prev;
+
+		if (link->prev == NULL) {
+			list->head = new_link;
+		} else {
+			link->prev->next = new_link;
+		}
+
+		link->prev = new_link;
+	}
+
+	// Adjust the size
+	list->size++;
+
+	return 0;
+}
+
+int
+idlist_remove(IDList *list, IDList_Link *link)
+{
+	// Do not allow a NULL link or removal from empty list
+	if (link == NULL || idlist_size(list) == 0) {
+		return -1;
+	}
+
+	if (link == list->head) {
+		// Remove from the head of the list
+
+		list->head = link->next;
+
+		if (list->head == NULL) {
+			list->tail = NULL;
+		} else {
+			link->next->prev = NULL;
+		}
+	} else {
+		// Remove from somewhere but the head
+
+		link->prev->next = link->next;
+
+		if (link->next == NULL) {
+			list->tail = link->prev;
+		} else {
+			link->next->prev = link->prev;
+		}
+	}
+
+	link->prev = NULL;
+	link->next = NULL;
+
+	// Adjust the size of the list
+	list->size--;
+
+	return 0;
+}
@@ -0,0 +1,158 @@
+/**
+ * \file idlist.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Definitions of an intrusive doubly linked-list ADT
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#ifndef IDLIST_h
+#define IDLIST_h
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+/**
+ * \struct IDList_Link
+ * \brief Link embedded in each object stored in an intrusive doubly linked-list
+ *
+ * The caller embeds an IDList_Link member in its own struct and passes a pointer to it, so the
+ * list never allocates; *idlist_entry* recovers the enclosing object from a link.
+ */
+typedef struct IDList_Link_s {
+	struct IDList_Link_s *prev; ///< Pointer to prev link in list
+	struct IDList_Link_s *next; ///< Pointer to next link in list
+
+} IDList_Link;
+
+/**
+ * \struct IDList
+ * \brief Intrusive doubly linked-list
+ */
+typedef struct IDList_s {
+	int size; ///< Number of links in list
+
+	IDList_Link *head; ///< Pointer to first link in list
+	IDList_Link *tail; ///< Pointer to last link in list
+
+} IDList;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// List Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * \brief Function to initialize an intrusive doubly linked-list
+ * 
+ * \pre Must be called before list can be used by any other operation
+ * 
+ * The list does not own the objects linked into it, so there is no `destroy` callback and no
+ * destroy operation.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list The intrusive doubly linked-list to init
+ */
+void
+idlist_init(IDList *list);
+
+/**
+ * \brief Function to link an object into an intrusive doubly linked-list
+ * 
+ * Links `new_link` just after `link`. When inserting into an empty list, `link` should be NULL.
+ * `new_link` must not currently be linked into any list.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list     The intrusive doubly linked-list to insert into
+ * \param link     Pointer to link to insert after
+ * \param new_link The link embedded in the object to insert
+ * 
+ * \return 0 if inserting into list was successful, otherwise -1
+ */
+int
+idlist_insert_next(IDList *list, IDList_Link *link, IDList_Link *new_link);
+
+/**
+ * \brief Function to link an object into an intrusive doubly linked-list
+ * 
+ * Links `new_link` just before `link`. When inserting into an empty list, `link` should be
+ * NULL. `new_link` must not currently be linked into any list.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list     The intrusive doubly linked-list to insert into
+ * \param link     Pointer to link to insert before
+ * \param new_link The link embedded in the object to insert
+ * 
+ * \return 0 if inserting into list was successful, otherwise -1
+ */
+int
+idlist_insert_prev(IDList *list, IDList_Link *link, IDList_Link *new_link);
+
+/**
+ * \brief Function to unlink an object from an intrusive doubly linked-list
+ * 
+ * Unlinks `link` from the list. The object containing it is not freed.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list The intrusive doubly linked-list to remove from
+ * \param link Pointer to link to remove
+ * 
+ * \return 0 if removing from list was successful, otherwise -1
+ */
+int
+idlist_remove(IDList *list, IDList_Link *link);
+
+/**
+ * MACRO that evaluates to the object of `type` whose `member` is the given link
+ */
+#define idlist_entry(link, type, member) ((type *)((char *)(link) - offsetof(type, member)))
+
+/**
+ * MACRO that evaluates to the number of links in the intrusive doubly linked-list
+ */
+#define idlist_size(list) ((list)->size)
+
+/**
+ * MACRO that evaluates to the link at the head of an intrusive doubly linked-list
+ */
+#define idlist_head(list) ((list)->head)
+
+/**
+ * MACRO that evaluates to the link at the tail of an intrusive doubly linked-list
+ */
+#define idlist_tail(list) ((list)->tail)
+
+/**
+ * MACRO that determines whether link is the head of intrusive doubly linked-list
+ */
+#define idlist_is_head(link) ((link)->prev == NULL ? 1 : 0)
+
+/**
+ * MACRO that determines whether link is the tail of intrusive doubly linked-list
+ */
+#define idlist_is_tail(link) ((link)->next == NULL ? 1 : 0)
+
+/**
+ * MACRO that evaluates to the next link given a link in an intrusive doubly linked-list
+ */
+#define idlist_next(link) ((link)->next)
+
+/**
+ * MACRO that evaluates to the prev link given a link in an intrusive doubly linked-list
+ */
+#define idlist_prev(link) ((link)->prev)
+
+#ifdef __cplusplus
+}
+#endif
+#endif // IDLIST_h
@@ -0,0 +1,97 @@
+/**
+ * \file ilist.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of an intrusive linked-list ADT
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include "ilist.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// List Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void
+ilist_init(IList *list)
+{
+	// Initialize the list
+	list->size = 0;
+	list->head = NULL;
+	list->tail = NULL;
+}
+
+int
+ilist_insert_next(IList *list, IList_Link *link, IList_Link *new_link)
+{
+	if (new_link == NULL) {
+		return -1;
+	}
+
+	if (link == NULL) {
+		// Insert at head of the linked-list
+
+		if (ilist_size(list) == 0) {
+			list->tail = new_link;
+		}
+
+		new_link->next = list->head;
+		list->head = new_link;
+	} else {
+		// Insert somewhere other than the head
+
+		if (link->next == NULL) {
+			list->tail = new_link;
+		}
+
+		new_link->next = link->next;
+		link->next = new_link;
+	}
+
+	// Adjust the size
+	list->size++;
+
+	return 0;
+}
+
+int
+ilist_remove_next(IList *list, IList_Link *link, IList_Link **removed)
+{
+	IList_Link *old_link;
+
+	// Check for empty list!
+	if (ilist_size(list) == 0) {
+		return -1;
+	}
+
+	if (link == NULL) {
+		// Remove from the head of the linked-list
+
+		old_link = list->head;
+		list->head = old_link->next;
+
+		if (ilist_size(list) == 1) {
+			list->tail = NULL;
+		}
+	} else {
+		// Remove from somewhere other than the head
+
+		if (link->next == NULL) {
+			return -1;
+		}
+
+		old_link = link->next;
+		link->next = old_link->next;
+
+		if (link->next == NULL) {
+			list->tail = link;
+		}
+	}
+
+	old_link->next = NULL;
+	*removed = old_link;
+
+	// Adjust the size of the list
+	list->size--;
+
+	return 0;
+}
@@ -0,0 +1,139 @@
+/**
+ * \file ilist.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Definitions of an intrusive linked-list ADT
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#ifndef ILIST_h
+#define ILIST_h
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+/**
+ * \struct IList_Link
+ * \brief Link embedded in each object stored in an intrusive linked-list
+ *
+ * Unlike *List*, which allocates a List_Element pointing to the data, an intrusive list links
+ * the objects themselves: the caller embeds an IList_Link member in its own struct and passes a
+ * pointer to it. The list never allocates, and *ilist_entry* recovers the enclosing object.
+ */
+typedef struct IList_Link_s {
+	struct IList_Link_s *next; ///< Pointer to next link in list
+
+} IList_Link;
+
+/**
+ * \struct IList
+ * \brief Intrusive linked-list
+ */
+typedef struct IList_s {
+	int size; ///< Number of links in list
+
+	IList_Link *head; ///< Pointer to first link in list
+	IList_Link *tail; ///< Pointer to last link in list
+
+} IList;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// List Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * \brief Function to initialize an intrusive linked-list
+ * 
+ * \pre Must be called before the list can be used by any other operation
+ * 
+ * The list does not own the objects linked into it, so there is no `destroy` callback and no
+ * destroy operation; objects are simply unlinked or abandoned along with the list.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list The intrusive linked-list to init
+ */
+void
+ilist_init(IList *list);
+
+/**
+ * \brief Function to link an object into an intrusive linked-list
+ * 
+ * Links `new_link` just after `link`. If `link` is NULL, `new_link` becomes the head of the
+ * list. `new_link` must not currently be linked into any list, and the object containing it
+ * must remain valid for as long as it stays linked.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list     The intrusive linked-list to insert into
+ * \param link     Pointer to link to insert after
+ * \param new_link The link embedded in the object to insert
+ * 
+ * \return 0 if inserting into list was successful, otherwise -1
+ */
+int
+ilist_insert_next(IList *list, IList_Link *link, IList_Link *new_link);
+
+/**
+ * \brief Function to unlink an object from an intrusive linked-list
+ * 
+ * Unlinks the link just past `link`. If `link` is NULL, the head of the list is unlinked. Upon
+ * return `removed` points to the unlinked link; the object containing it is not freed.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list    The intrusive linked-list to remove from
+ * \param link    Pointer to link to remove after
+ * \param removed The link removed
+ * 
+ * \return 0 if removing from list was successful, otherwise -1
+ */
+int
+ilist_remove_next(IList *list, IList_Link *link, IList_Link **removed);
+
+/**
+ * MACRO that evaluates to the object of `type` whose `member` is the given link
+ */
+#define ilist_entry(link, type, member) ((type *)((char *)(link) - offsetof(type, member)))
+
+/**
+ * MACRO that evaluates to the number of links in the intrusive linked-list
+ */
+#define ilist_size(list) ((list)->size)
+
+/**
+ * MACRO that evaluates to the link at the head of an intrusive linked-list
+ */
+#define ilist_head(list) ((list)->head)
+
+/**
+ * MACRO that evaluates to the link at the tail of an intrusive linked-list
+ */
+#define ilist_tail(list) ((list)->tail)
+
+/**
+ * MACRO that determines whether link is the head of intrusive linked-list
+ */
+#define ilist_is_head(list, link) ((link) == (list)->head ? 1 : 0)
+
+/**
+ * MACRO that determines whether link is the tail of intrusive linked-list
+ */
+#define ilist_is_tail(link) ((link)->next == NULL ? 1 : 0)
+
+/**
+ * MACRO that evaluates to the next link given a link in an intrusive linked-list
+ */
+#define ilist_next(link) ((link)->next)
+
+#ifdef __cplusplus
+}
+#endif
+#endif // ILIST_h
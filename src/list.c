@@ -19,21 +19,85 @@ list_init(List *list, void (*destroy)(void *data))
 {
 	// Initialize the list
 	list->size = 0;
+	list->match = NULL;
 	list->destroy = destroy;
 	list->head = NULL;
 	list->tail = NULL;
+	list->allocator = allocator_default;
+	list->element_size = 0;
+}
+
+void
+list_init_inline(List *list, void (*destroy)(void *data), size_t element_size,
+                 const Allocator *allocator)
+{
+	// Initialize the list, then size its elements for inline values
+	if (allocator != NULL) {
+		list_init_allocator(list, destroy, allocator);
+	} else {
+		list_init(list, destroy);
+	}
+
+	list->element_size = element_size;
+}
+
+void
+list_init_allocator(List *list, void (*destroy)(void *data), const Allocator *allocator)
+{
+	// Initialize the list, then attach the allocator
+	list_init(list, destroy);
+	list->allocator = *allocator;
+}
+
+void
+list_init_pool(List *list, void (*destroy)(void *data), Pool *pool)
+{
+	Allocator allocator = pool_allocator(pool);
+
+	list_init_allocator(list, destroy, &allocator);
+}
+
+int
+list_init_arena(List *list, void (*destroy)(void *data), size_t slab_count)
+{
+	Allocator allocator;
+
+	if (pool_arena_allocator(&allocator, sizeof (List_Element), slab_count, 0) != 0) {
+		return -1;
+	}
+
+	list_init_allocator(list, destroy, &allocator);
+
+	return 0;
 }
 
 void
 list_destroy(List *list)
 {
+	List_Element *element;
 	void *data;
 
-	// Remove each element in list
+	if (list->allocator.release != NULL) {
+		// Elements go away with the arena, so only the data needs visiting
+		if (list->destroy != NULL) {
+			for (element = list->head; element != NULL; element = element->next) {
+				list->destroy(element->data);
+			}
+		}
+
+		list->allocator.release(list->allocator.context);
+		memset(list, 0, sizeof (List));
+		return;
+	}
+
+	// Remove each element in list, destroying its data first since an inline value goes with it
 	while (list_size(list) > 0) {
-		if (list_remove_next(list, NULL, (void**)&data) == 0 && list->destroy != NULL) {
-			list->destroy(data);
+		if (list->destroy != NULL) {
+			list->destroy(list_data(list_head(list)));
 		}
+
+		data = NULL;
+		list_remove_next(list, NULL, (void**)&data);
 	}
 
 	// No operations permitted at this point -- clear memory as precaution
@@ -46,12 +110,20 @@ list_insert_next(List *list, List_Element *element, const void *data)
 	List_Element *new_element;
 
 	// Allocate storage for the element
-	if ((new_element = (List_Element*)malloc(sizeof (List_Element))) == NULL) {
+	new_element = (List_Element*)allocator_alloc(&list->allocator,
+	                                             sizeof (List_Element) + list->element_size);
+
+	if (new_element == NULL) {
 		return -1;
 	}
 
-	// Insert the element into the linked-list
-	new_element->data = (void *)data;
+	// Insert the element into the linked-list, copying the value in if it is stored inline
+	if (list->element_size > 0) {
+		memcpy(new_element->value, data, list->element_size);
+		new_element->data = new_element->value;
+	} else {
+		new_element->data = (void *)data;
+	}
 
 	if (element == NULL) {
 		// Insert at head of the linked-list
@@ -92,7 +164,6 @@ list_remove_next(List *list, List_Element *element, void **data)
 	if (element == NULL) {
 		// Remove from the head of the linked-list
 		
-		*data = list->head->data;
 		old_element = list->head;
 		list->head = list->head->next;
 
@@ -106,7 +177,6 @@ list_remove_next(List *list, List_Element *element, void **data)
 			return -1;
 		}
 
-		*data = element->next->data;
 		old_element = element->next;
 		element->next = element->next->next;
 
@@ -115,11 +185,379 @@ list_remove_next(List *list, List_Element *element, void **data)
 		}
 	}
 
+	// Hand over the data -- an inline value is copied out before its storage is freed
+	if (list->element_size == 0) {
+		*data = old_element->data;
+	} else if (*data != NULL) {
+		memcpy(*data, old_element->value, list->element_size);
+	}
+
 	// Free storage allocated by the abstract datatype
-	free(old_element);
+	allocator_free(&list->allocator, old_element, sizeof (List_Element) + list->element_size);
 
 	// Adjust the size of the list
 	list->size--;
 
 	return 0;
-}
\ No newline at end of file
+}
+
+int
+list_insert_next_n(List *list, List_Element *element, void *const *data, int count)
+{
+	List_Element *first = NULL, *last = NULL, *new_element;
+	int i;
+
+	if (count <= 0) {
+		return count == 0 ? 0 : -1;
+	}
+
+	// Build a private chain of the new elements
+	for (i = 0; i < count; i++) {
+		new_element = (List_Element*)allocator_alloc(&list->allocator,
+		                                             sizeof (List_Element) + list->element_size);
+
+		if (new_element == NULL) {
+			// Undo the partial chain so the list is left as it was
+			while (first != NULL) {
+				new_element = first;
+				first = first->next;
+				allocator_free(&list->allocator, new_element,
+				               sizeof (List_Element) + list->element_size);
+			}
+
+			return -1;
+		}
+
+		if (list->element_size > 0) {
+			memcpy(new_element->value, data[i], list->element_size);
+			new_element->data = new_element->value;
+		} else {
+			new_element->data = data[i];
+		}
+
+		if (first == NULL) {
+			first = new_element;
+		} else {
+			last->next = new_element;
+		}
+
+		last = new_element;
+	}
+
+	// Splice the chain into the linked-list
+	if (element == NULL) {
+		if (list_size(list) == 0) {
+			list->tail = last;
+		}
+
+		last->next = list->head;
+		list->head = first;
+	} else {
+		if (element->next == NULL) {
+			list->tail = last;
+		}
+
+		last->next = element->next;
+		element->next = first;
+	}
+
+	// Adjust the size
+	list->size += count;
+
+	return 0;
+}
+
+int
+list_remove_next_n(List *list, List_Element *element, void **data, int count)
+{
+	List_Element *first, *last, *old_element;
+	int removed;
+
+	first = element == NULL ? list->head : element->next;
+
+	if (first == NULL || count <= 0) {
+		return 0;
+	}
+
+	// Find the end of the run to remove
+	for (last = first, removed = 1; removed < count && last->next != NULL; removed++) {
+		last = last->next;
+	}
+
+	// Unlink the run from the linked-list
+	if (element == NULL) {
+		list->head = last->next;
+	} else {
+		element->next = last->next;
+	}
+
+	if (last->next == NULL) {
+		list->tail = element;
+	}
+
+	list->size -= removed;
+	last->next = NULL;
+
+	// Hand over the data and free the elements
+	for (old_element = first; old_element != NULL; data++) {
+		first = old_element->next;
+
+		if (list->element_size == 0) {
+			*data = old_element->data;
+		} else if (*data != NULL) {
+			memcpy(*data, old_element->value, list->element_size);
+		}
+
+		allocator_free(&list->allocator, old_element, sizeof (List_Element) + list->element_size);
+		old_element = first;
+	}
+
+	return removed;
+}
+
+// Merge two sorted, NULL-terminated chains; `first` holds the earlier elements, so it wins ties
+static List_Element *
+merge_runs(List_Element *first, List_Element *second, int (*compare)(const void *key1, const void *key2))
+{
+	List_Element *head, **link = &head;
+
+	while (first != NULL && second != NULL) {
+		if (compare(first->data, second->data) <= 0) {
+			*link = first;
+			first = first->next;
+		} else {
+			*link = second;
+			second = second->next;
+		}
+
+		link = &(*link)->next;
+	}
+
+	*link = first != NULL ? first : second;
+
+	return head;
+}
+
+void
+list_sort(List *list, int (*compare)(const void *key1, const void *key2))
+{
+	// runs[i] is NULL or a sorted chain of 2^i elements, all earlier than those in runs[i - 1]
+	List_Element *runs[sizeof (int) * 8], *run, *element, *next;
+	int used = 0, i;
+
+	if (list->head == NULL) {
+		return;
+	}
+
+	// Feed the elements in one at a time, merging equal-sized runs like a binary counter carries;
+	// recently touched runs get merged while they are still in cache
+	for (element = list->head; element != NULL; element = next) {
+		next = element->next;
+		element->next = NULL;
+		run = element;
+
+		for (i = 0; i < used && runs[i] != NULL; i++) {
+			run = merge_runs(runs[i], run, compare);
+			runs[i] = NULL;
+		}
+
+		if (i == used) {
+			used++;
+		}
+
+		runs[i] = run;
+	}
+
+	// Merge the leftover runs, smallest (latest) first
+	for (run = NULL, i = 0; i < used; i++) {
+		if (runs[i] != NULL) {
+			run = run == NULL ? runs[i] : merge_runs(runs[i], run, compare);
+		}
+	}
+
+	// Walk the result once to find the tail
+	list->head = run;
+
+	while (run->next != NULL) {
+		run = run->next;
+	}
+
+	list->tail = run;
+}
+
+// Lists can only trade elements if they allocate them from the same place and at the same size,
+// and that place is not an arena, which belongs to exactly one list and is released with it
+static int
+same_storage(const List *list, const List *other)
+{
+	return list != other && allocator_same(&list->allocator, &other->allocator) &&
+	       list->allocator.release == NULL && list->element_size == other->element_size;
+}
+
+int
+list_splice(List *list, List_Element *element, List *other)
+{
+	if (!same_storage(list, other)) {
+		return -1;
+	}
+
+	if (list_size(other) == 0) {
+		return 0;
+	}
+
+	// Link the whole run of `other` in with two pointer updates
+	if (element == NULL) {
+		if (list_size(list) == 0) {
+			list->tail = other->tail;
+		}
+
+		other->tail->next = list->head;
+		list->head = other->head;
+	} else {
+		if (element->next == NULL) {
+			list->tail = other->tail;
+		}
+
+		other->tail->next = element->next;
+		element->next = other->head;
+	}
+
+	// Adjust the sizes
+	list->size += other->size;
+
+	other->size = 0;
+	other->head = NULL;
+	other->tail = NULL;
+
+	return 0;
+}
+
+int
+list_concat(List *list, List *other)
+{
+	return list_splice(list, list_tail(list), other);
+}
+
+int
+list_split(List *list, List_Element *element, List *other)
+{
+	List_Element *first, *last;
+	int count;
+
+	if (!same_storage(list, other) || list_size(other) != 0) {
+		return -1;
+	}
+
+	first = element == NULL ? list->head : element->next;
+
+	if (first == NULL) {
+		return 0;
+	}
+
+	// The run ends at the tail, but its length has to be counted
+	for (count = 1, last = first; last->next != NULL; last = last->next) {
+		count++;
+	}
+
+	// Cut the run off after `element`
+	if (element == NULL) {
+		list->head = NULL;
+	} else {
+		element->next = NULL;
+	}
+
+	list->tail = element;
+	list->size -= count;
+
+	other->head = first;
+	other->tail = last;
+	other->size = count;
+
+	return 0;
+}
+
+List_Element *
+list_find_next(const List *list, List_Element *element, const void *data)
+{
+	if (list->match == NULL) {
+		return NULL;
+	}
+
+	element = element == NULL ? list->head : element->next;
+
+	while (element != NULL) {
+		if (list->match(data, element->data)) {
+			return element;
+		}
+
+		element = element->next;
+	}
+
+	return NULL;
+}
+
+List_Element *
+list_find(const List *list, const void *data)
+{
+	return list_find_next(list, NULL, data);
+}
+
+int
+list_count(const List *list, const void *data)
+{
+	List_Element *element;
+	int count = 0;
+
+	if (list->match == NULL) {
+		return -1;
+	}
+
+	for (element = list->head; element != NULL; element = element->next) {
+		count += list->match(data, element->data) != 0;
+	}
+
+	return count;
+}
+
+int
+list_remove_matching(List *list, const void *data)
+{
+	List_Element *prev = NULL, *element, *next;
+	int removed = 0;
+
+	if (list->match == NULL) {
+		return -1;
+	}
+
+	for (element = list->head; element != NULL; element = next) {
+		next = element->next;
+
+		if (!list->match(data, element->data)) {
+			prev = element;
+			continue;
+		}
+
+		// Unlink the element
+		if (prev == NULL) {
+			list->head = next;
+		} else {
+			prev->next = next;
+		}
+
+		if (next == NULL) {
+			list->tail = prev;
+		}
+
+		// Destroy the data, then free storage allocated by the abstract datatype
+		if (list->destroy != NULL) {
+			list->destroy(element->data);
+		}
+
+		allocator_free(&list->allocator, element, sizeof (List_Element) + list->element_size);
+
+		list->size--;
+		removed++;
+	}
+
+	return removed;
+}
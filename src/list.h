@@ -15,6 +15,9 @@ extern "C"
 {
 #endif
 
+#include "allocator.h"
+#include "pool.h"
+
 // -------------------------------------------------------------------------------------------------
 // Definitions
 // -------------------------------------------------------------------------------------------------
@@ -27,6 +30,8 @@ typedef struct List_Element_s {
 	void *data;                  ///< Pointer to data
 	struct List_Element_s *next; ///< Pointer to next element in list
 
+	unsigned char value[];       ///< Inline storage that `data` points to, if the list has any
+
 } List_Element;
 
 /**
@@ -36,13 +41,16 @@ typedef struct List_Element_s {
 typedef struct List_s {
 	int size; ///< Number of elements in list
 
-	// int (*match)(const void *a, const void *b);
+	int (*match)(const void *a, const void *b); ///< Nonzero if data `b` matches key `a`, or NULL
 
 	void (*destroy)(void *data); ///< Function pointer to destroy element
 
 	List_Element *head; ///< Pointer to first element in list
 	List_Element *tail; ///< Pointer to last element in list
 
+	Allocator allocator; ///< Allocator used for element storage
+	size_t element_size; ///< Size of values stored inline in each element, or 0
+
 } List;
 
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -61,6 +69,10 @@ typedef struct List_s {
  * should be set to *free* to free the data as the linked-list is destroyed. For a linked-list
  * containing data that should not be freed, `destroy` should be set to NULL.
  * 
+ * The list's `match` function starts out NULL, so *list_find*, *list_find_next*, *list_count* and
+ * *list_remove_matching* fail until one is set with *list_set_match*. The other init functions
+ * behave the same way.
+ * 
  * Complexity: O(1)
  * 
  * \param list    The linked-list to init
@@ -69,6 +81,89 @@ typedef struct List_s {
 void 
 list_init(List *list, void (*destroy)(void *data));
 
+/**
+ * \brief Function to initialize a linked-list with a custom element allocator
+ * 
+ * \pre Must be called before the list can be used by any other operation
+ * 
+ * Behaves like *list_init*, except that *list_insert_next* and *list_remove_next* obtain and
+ * release element storage through `allocator` rather than *malloc* and *free*. The descriptor is
+ * copied into the list, but whatever its `context` refers to must outlive the list.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list      The linked-list to init
+ * \param destroy   Function pointer to free data element memory
+ * \param allocator The allocator to obtain element storage from
+ */
+void
+list_init_allocator(List *list, void (*destroy)(void *data), const Allocator *allocator);
+
+/**
+ * \brief Function to initialize a linked-list that stores fixed-size values inline
+ * 
+ * \pre Must be called before the list can be used by any other operation
+ * 
+ * Rather than storing the `data` pointer passed to *list_insert_next*, each element copies
+ * `element_size` bytes from it into storage that trails the element, and *list_data* points at
+ * that copy. Small payloads therefore need no allocation of their own and sit next to their
+ * link. The inline storage is aligned for a pointer.
+ * 
+ * Upon *list_remove_next*, the value is copied into the buffer that `*data` points to (which must
+ * hold `element_size` bytes), or dropped if `*data` is NULL. `destroy`, if set, is called with a
+ * pointer to each inline value still in the list when it is destroyed.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list         The linked-list to init
+ * \param destroy      Function pointer to release resources held by a value, or NULL
+ * \param element_size Size in bytes of each value (must be greater than 0)
+ * \param allocator    The allocator to obtain element storage from, or NULL for the default
+ */
+void
+list_init_inline(List *list, void (*destroy)(void *data), size_t element_size,
+                 const Allocator *allocator);
+
+/**
+ * \brief Function to initialize a linked-list whose elements are allocated from a pool
+ * 
+ * \pre Must be called before the list can be used by any other operation
+ * 
+ * Shorthand for *list_init_allocator* with the allocator returned by *pool_allocator*, so that
+ * *list_insert_next* takes elements from `pool` and *list_remove_next* returns them to it. The
+ * pool must have been initialized with an object size of at least `sizeof (List_Element)` and
+ * must outlive the list. A pool may be shared by several lists; its memory is released in bulk
+ * by *pool_destroy* once every list using it has been destroyed.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list    The linked-list to init
+ * \param destroy Function pointer to free data element memory
+ * \param pool    The pool to allocate elements from
+ */
+void
+list_init_pool(List *list, void (*destroy)(void *data), Pool *pool);
+
+/**
+ * \brief Function to initialize an arena-backed linked-list
+ * 
+ * \pre Must be called before the list can be used by any other operation
+ * 
+ * The list allocates its elements from a private pool created by *pool_arena_allocator*. 
+ * Elements removed while the list is in use are recycled by the pool, and *list_destroy* 
+ * releases all of them at once instead of freeing them one at a time.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list       The linked-list to init
+ * \param destroy    Function pointer to free data element memory
+ * \param slab_count Number of elements per arena slab, or 0 for POOL_DEFAULT_SLAB_COUNT
+ * 
+ * \return 0 if the arena was created, otherwise -1
+ */
+int
+list_init_arena(List *list, void (*destroy)(void *data), size_t slab_count);
+
 /**
  * \brief Function to destroy a linked-list
  * 
@@ -76,10 +171,14 @@ list_init(List *list, void (*destroy)(void *data));
  * passed as `destroy` to *list_init* once for each element as it is removed, provided `destroy`
  * was not set to NULL.
  * 
+ * If the list's allocator has a `release` function (e.g. a list set up by *list_init_arena*),
+ * the elements are not freed individually: `destroy` is called for each element's data, if set,
+ * and the allocator is then released in one shot.
+ * 
  * \note
  * No operation is permitted after *list_destroy* is called unless *list_init* is called again.
  *  
- * Complexity: O(n)
+ * Complexity: O(n), or O(1) for an arena-backed list whose `destroy` is NULL
  * 
  * \param list The linked-list to destroy
  */
@@ -110,7 +209,8 @@ list_insert_next(List *list, List_Element *element, const void *data);
  * 
  * Removes the element just past `element` from the linked-list. If `element` is NULL, the 
  * element at the head of the list is removed. Upon return `data` points to the data stored
- * in the element that was removed.
+ * in the element that was removed. For a list set up by *list_init_inline*, `*data` must instead
+ * point to a buffer the value is copied into (or be NULL to drop the value).
  * 
  * Complexity: O(1)
  * 
@@ -123,6 +223,193 @@ list_insert_next(List *list, List_Element *element, const void *data);
 int
 list_remove_next(List *list, List_Element *element, void **data);
 
+/**
+ * \brief Function to insert several elements into a linked-list at once
+ * 
+ * Inserts `count` elements just after `element` (or at the head if `element` is NULL), holding
+ * `data[0]` to `data[count - 1]` in that order. The elements are allocated and chained together
+ * privately first, then spliced into the list with a single link update, so either all of them
+ * are inserted or, if an allocation fails, none are.
+ * 
+ * Complexity: O(count)
+ * 
+ * \param list    The linked-list to insert elements into
+ * \param element Pointer to element to insert after
+ * \param data    Array of `count` data to insert
+ * \param count   Number of elements to insert
+ * 
+ * \return 0 if inserting into list was successful, otherwise -1
+ */
+int
+list_insert_next_n(List *list, List_Element *element, void *const *data, int count);
+
+/**
+ * \brief Function to remove several elements from a linked-list at once
+ * 
+ * Removes up to `count` elements just past `element` (or from the head if `element` is NULL),
+ * storing their data in `data[0]`, `data[1]`, ... in list order. The run of elements is
+ * unlinked with a single link update. For a list set up by *list_init_inline*, each `data[i]`
+ * must instead point to a buffer the value is copied into (or be NULL to drop the value).
+ * 
+ * \note
+ * Each element is still freed individually, since elements may have been allocated at different
+ * times and the allocator interface frees one element at a time.
+ * 
+ * Complexity: O(count)
+ * 
+ * \param list    The linked-list to remove elements from
+ * \param element Pointer to element to remove after
+ * \param data    Array of room for `count` data removed
+ * \param count   Maximum number of elements to remove
+ * 
+ * \return Number of elements removed, which is less than `count` if the list ran out
+ */
+int
+list_remove_next_n(List *list, List_Element *element, void **data, int count);
+
+/**
+ * \brief Function to sort a linked-list in place
+ * 
+ * Sorts the elements into ascending order as defined by `compare` by relinking the existing
+ * elements with a bottom-up merge sort. No element is allocated, freed or moved in memory, so
+ * pointers to elements and to their data stay valid. The sort is stable: elements that compare
+ * equal keep their relative order.
+ * 
+ * Complexity: O(n log n) comparisons, O(1) extra memory
+ * 
+ * \param list    The linked-list to sort
+ * \param compare Function returning less than, equal to or greater than 0 when the data `key1`
+ *                is less than, equal to or greater than the data `key2` (as for *qsort*)
+ */
+void
+list_sort(List *list, int (*compare)(const void *key1, const void *key2));
+
+/**
+ * \brief Function to move every element of another linked-list into one
+ * 
+ * Links the elements of `other` in just after `element` (or at the head if `element` is NULL), in
+ * their order in `other`, by relinking pointers. No element is allocated, freed or copied, and
+ * `other` is left empty but initialized.
+ * 
+ * Both lists must allocate their elements from the same allocator and store the same inline
+ * size, since the moved elements are later freed by `list`. Arena-backed lists cannot trade
+ * elements, as each arena belongs to one list. The `destroy` function of `list` applies to the
+ * moved data from then on.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list    The linked-list to move elements into
+ * \param element Pointer to element to insert after
+ * \param other   The linked-list to take elements from
+ * 
+ * \return 0 if the elements were moved, or -1 if the lists' storage differs or they are the same
+ */
+int
+list_splice(List *list, List_Element *element, List *other);
+
+/**
+ * \brief Function to append every element of another linked-list to the end of one
+ * 
+ * Same as *list_splice* after the last element of `list`.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list  The linked-list to append to
+ * \param other The linked-list to take elements from
+ * 
+ * \return 0 if the elements were moved, or -1 if the lists' storage differs or they are the same
+ */
+int
+list_concat(List *list, List *other);
+
+/**
+ * \brief Function to split a linked-list in two
+ * 
+ * Moves the elements after `element` (every element if `element` is NULL) into `other` by
+ * relinking pointers, keeping their order. No element is allocated, freed or copied.
+ * 
+ * Complexity: O(k) where k is the number of elements moved, which have to be counted
+ * 
+ * \param list    The linked-list to split
+ * \param element Pointer to element to split after, or NULL to move every element
+ * \param other   Empty linked-list with the same storage as `list`, to move elements into
+ * 
+ * \return 0 if the elements were moved, or -1 if `other` is not empty, its storage differs or
+ *         it is `list` itself
+ */
+int
+list_split(List *list, List_Element *element, List *other);
+
+/**
+ * \brief Function to find the first element whose data matches a key
+ * 
+ * Calls the `match` function set with *list_set_match* as `match(data, element_data)` on each
+ * element from the head on, and stops at the first one for which it returns nonzero. Each step
+ * depends on loading the element before it, so on a list that does not fit in cache the search
+ * is bound by memory latency rather than by `match`.
+ * 
+ * Complexity: O(n)
+ * 
+ * \param list The linked-list to search
+ * \param data The key passed to `match`
+ * 
+ * \return The first matching element, or NULL if none matches or no `match` function is set
+ */
+List_Element *
+list_find(const List *list, const void *data);
+
+/**
+ * \brief Function to find the next element whose data matches a key
+ * 
+ * Same as *list_find*, but searches from the element after `element` (or from the head if
+ * `element` is NULL).
+ * 
+ * Complexity: O(n)
+ * 
+ * \param list    The linked-list to search
+ * \param element Pointer to element to search after
+ * \param data    The key passed to `match`
+ * 
+ * \return The next matching element, or NULL if none matches or no `match` function is set
+ */
+List_Element *
+list_find_next(const List *list, List_Element *element, const void *data);
+
+/**
+ * \brief Function to count the elements whose data matches a key
+ * 
+ * Complexity: O(n)
+ * 
+ * \param list The linked-list to search
+ * \param data The key passed to `match`
+ * 
+ * \return The number of matching elements, or -1 if no `match` function is set
+ */
+int
+list_count(const List *list, const void *data);
+
+/**
+ * \brief Function to remove every element whose data matches a key
+ * 
+ * Unlike *list_remove_next*, the data of each removed element is not handed back;
+ * it is passed to the `destroy` function given at init, provided `destroy` was not set to NULL.
+ * 
+ * Complexity: O(n)
+ * 
+ * \param list The linked-list to remove elements from
+ * \param data The key passed to `match`
+ * 
+ * \return The number of elements removed, or -1 if no `match` function is set
+ */
+int
+list_remove_matching(List *list, const void *data);
+
+/**
+ * MACRO that sets the function used by *list_find* and friends to compare a key with the data
+ * of an element; it returns nonzero if they match, otherwise 0
+ */
+#define list_set_match(list, function) ((list)->match = (function))
+
 /**
  * MACRO that evaluates to the number of elements in the linked-list
  */
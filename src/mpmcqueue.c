@@ -0,0 +1,247 @@
+/**
+ * \file mpmcqueue.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of a bounded lock-free multi-producer/multi-consumer queue
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include <sched.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mpmcqueue.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Queue Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+static void
+backoff(int *attempts)
+{
+	// Spin a while before giving the processor away, threads holding positions are rarely slow
+	if (++*attempts < MPMC_QUEUE_SPIN_COUNT) {
+#if defined(__x86_64__) || defined(__i386__)
+		__builtin_ia32_pause();
+#endif
+	} else {
+		sched_yield();
+	}
+}
+
+int
+mpmcqueue_init(MPMCQueue *queue, void (*destroy)(void *data), size_t capacity)
+{
+	size_t rounded = 2;
+	size_t i;
+
+	// A single slot could not tell a full ring from an empty one
+	while (rounded < capacity) {
+		if (rounded > ((size_t)-1 / sizeof (MPMCQueue_Slot)) / 2) {
+			return -1;
+		}
+
+		rounded *= 2;
+	}
+
+	if ((queue->slots = (MPMCQueue_Slot *)malloc(rounded * sizeof (MPMCQueue_Slot))) == NULL) {
+		return -1;
+	}
+
+	// Every slot starts out free for the first lap
+	for (i = 0; i < rounded; i++) {
+		atomic_init(&queue->slots[i].sequence, i);
+	}
+
+	// Initialize the queue
+	queue->capacity = rounded;
+	queue->destroy = destroy;
+
+	atomic_init(&queue->tail, 0);
+	atomic_init(&queue->head, 0);
+
+	return 0;
+}
+
+void
+mpmcqueue_destroy(MPMCQueue *queue)
+{
+	void *data;
+
+	// Destroy the data of each element, front of the queue first
+	if (queue->destroy != NULL) {
+		while (mpmcqueue_try_dequeue(queue, &data) == 0) {
+			queue->destroy(data);
+		}
+	}
+
+	free(queue->slots);
+
+	// No operations permitted at this point -- clear memory as precaution
+	memset(queue, 0, sizeof (MPMCQueue));
+}
+
+int
+mpmcqueue_try_enqueue(MPMCQueue *queue, const void *data)
+{
+	MPMCQueue_Slot *slot;
+	size_t position, sequence;
+	intptr_t lag;
+
+	position = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+
+	for (;;) {
+		slot = &queue->slots[position & (queue->capacity - 1)];
+		sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+		lag = (intptr_t)sequence - (intptr_t)position;
+
+		if (lag == 0) {
+			// The slot is free for this position -- try to claim it
+			if (atomic_compare_exchange_weak_explicit(&queue->tail, &position, position + 1,
+			                                          memory_order_relaxed, memory_order_relaxed)) {
+				break;
+			}
+		} else if (lag < 0) {
+			// The slot still holds the element from the previous lap
+			return -1;
+		} else {
+			// Another producer claimed this position first
+			position = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+		}
+	}
+
+	slot->data = (void *)data;
+
+	// Publish the slot to the consumer of this position
+	atomic_store_explicit(&slot->sequence, position + 1, memory_order_release);
+
+	return 0;
+}
+
+int
+mpmcqueue_try_dequeue(MPMCQueue *queue, void **data)
+{
+	MPMCQueue_Slot *slot;
+	size_t position, sequence;
+	intptr_t lag;
+
+	position = atomic_load_explicit(&queue->head, memory_order_relaxed);
+
+	for (;;) {
+		slot = &queue->slots[position & (queue->capacity - 1)];
+		sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+		lag = (intptr_t)sequence - (intptr_t)(position + 1);
+
+		if (lag == 0) {
+			// The slot holds this position's data -- try to claim it
+			if (atomic_compare_exchange_weak_explicit(&queue->head, &position, position + 1,
+			                                          memory_order_relaxed, memory_order_relaxed)) {
+				break;
+			}
+		} else if (lag < 0) {
+			// Nothing has been published at this position yet
+			return -1;
+		} else {
+			// Another consumer claimed this position first
+			position = atomic_load_explicit(&queue->head, memory_order_relaxed);
+		}
+	}
+
+	*data = slot->data;
+
+	// Hand the slot back to the producer of the same slot one lap later
+	atomic_store_explicit(&slot->sequence, position + queue->capacity, memory_order_release);
+
+	return 0;
+}
+
+// Number of slots from `position` on, up to `count`, whose sequence is `position + offset`
+static int
+ready_slots(MPMCQueue *queue, size_t position, size_t offset, int count)
+{
+	MPMCQueue_Slot *slot;
+	int ready;
+
+	for (ready = 0; ready < count && (size_t)ready < queue->capacity; ready++) {
+		slot = &queue->slots[(position + ready) & (queue->capacity - 1)];
+
+		if (atomic_load_explicit(&slot->sequence, memory_order_acquire) != position + ready + offset) {
+			break;
+		}
+	}
+
+	return ready;
+}
+
+int
+mpmcqueue_try_enqueue_n(MPMCQueue *queue, void *const *data, int count)
+{
+	MPMCQueue_Slot *slot;
+	size_t position;
+	int claimed, i;
+
+	position = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+
+	// Claim the run of free slots in one go; a slot free for its position stays free until that
+	// position is claimed, so the run is still free if the tail has not moved
+	do {
+		if ((claimed = ready_slots(queue, position, 0, count)) == 0) {
+			return 0;
+		}
+	} while (!atomic_compare_exchange_weak_explicit(&queue->tail, &position, position + claimed,
+	                                                memory_order_relaxed, memory_order_relaxed));
+
+	for (i = 0; i < claimed; i++) {
+		slot = &queue->slots[(position + i) & (queue->capacity - 1)];
+		slot->data = data[i];
+		atomic_store_explicit(&slot->sequence, position + i + 1, memory_order_release);
+	}
+
+	return claimed;
+}
+
+int
+mpmcqueue_try_dequeue_n(MPMCQueue *queue, void **data, int count)
+{
+	MPMCQueue_Slot *slot;
+	size_t position;
+	int claimed, i;
+
+	position = atomic_load_explicit(&queue->head, memory_order_relaxed);
+
+	// Claim the run of published slots in one go, see mpmcqueue_try_enqueue_n
+	do {
+		if ((claimed = ready_slots(queue, position, 1, count)) == 0) {
+			return 0;
+		}
+	} while (!atomic_compare_exchange_weak_explicit(&queue->head, &position, position + claimed,
+	                                                memory_order_relaxed, memory_order_relaxed));
+
+	for (i = 0; i < claimed; i++) {
+		slot = &queue->slots[(position + i) & (queue->capacity - 1)];
+		data[i] = slot->data;
+		atomic_store_explicit(&slot->sequence, position + i + queue->capacity, memory_order_release);
+	}
+
+	return claimed;
+}
+
+void
+mpmcqueue_enqueue(MPMCQueue *queue, const void *data)
+{
+	int attempts = 0;
+
+	while (mpmcqueue_try_enqueue(queue, data) != 0) {
+		backoff(&attempts);
+	}
+}
+
+void
+mpmcqueue_dequeue(MPMCQueue *queue, void **data)
+{
+	int attempts = 0;
+
+	while (mpmcqueue_try_dequeue(queue, data) != 0) {
+		backoff(&attempts);
+	}
+}
@@ -0,0 +1,207 @@
+/**
+ * \file mpmcqueue.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Definitions of a bounded lock-free multi-producer/multi-consumer queue
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#ifndef MPMCQUEUE_h
+#define MPMCQUEUE_h
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+/**
+ * Size of a cache line, used to keep the enqueue and dequeue positions apart
+ */
+#define MPMC_QUEUE_CACHELINE 64
+
+/**
+ * Number of failed attempts the blocking functions spin for before yielding the processor
+ */
+#define MPMC_QUEUE_SPIN_COUNT 64
+
+/**
+ * \struct MPMCQueue_Slot
+ * \brief Cell of an MPMCQueue ring
+ */
+typedef struct MPMCQueue_Slot_s {
+	atomic_size_t sequence; ///< Position the slot is ready for (see MPMCQueue)
+	void *data;             ///< Pointer to data
+
+} MPMCQueue_Slot;
+
+/**
+ * \struct MPMCQueue
+ * \brief Bounded queue safe for any number of producer and consumer threads
+ *
+ * Data pointers live in a power-of-two ring of slots, each stamped with a sequence number. A
+ * slot whose sequence equals an enqueue position is free for that position, and one whose
+ * sequence is one past a dequeue position holds that position's data. Producers claim a
+ * position by advancing `tail` with a compare-and-swap, fill the slot and then publish it by
+ * bumping its sequence; consumers do the same with `head` and hand the slot back for the next
+ * lap around the ring. Threads only contend on the position counter of their own side.
+ */
+typedef struct MPMCQueue_s {
+	MPMCQueue_Slot *slots; ///< Ring of slots
+	size_t capacity;       ///< Number of slots (a power of two, at least 2)
+
+	void (*destroy)(void *data); ///< Function pointer to destroy element
+
+	_Alignas(MPMC_QUEUE_CACHELINE)
+	atomic_size_t tail; ///< Next enqueue position
+
+	_Alignas(MPMC_QUEUE_CACHELINE)
+	atomic_size_t head; ///< Next dequeue position
+
+} MPMCQueue;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Queue Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * \brief Function to initialize a multi-producer/multi-consumer queue
+ *
+ * \pre Must be called, and must return, before any thread uses the queue
+ *
+ * See *list_init* for the meaning of `destroy`.
+ *
+ * Complexity: O(n) where n is the capacity
+ *
+ * \param queue    The queue to init
+ * \param destroy  Function pointer to free data element memory
+ * \param capacity Maximum number of elements in the queue, rounded up to a power of two (>= 2)
+ *
+ * \return 0 if the ring was allocated, otherwise -1
+ */
+int
+mpmcqueue_init(MPMCQueue *queue, void (*destroy)(void *data), size_t capacity);
+
+/**
+ * \brief Function to destroy a multi-producer/multi-consumer queue
+ *
+ * Calls the function passed as `destroy` to *mpmcqueue_init* once for each element still in the
+ * queue, provided `destroy` was not set to NULL, and frees the ring.
+ *
+ * \pre No thread may be using the queue
+ *
+ * Complexity: O(n), or O(1) if `destroy` is NULL
+ *
+ * \param queue The queue to destroy
+ */
+void
+mpmcqueue_destroy(MPMCQueue *queue);
+
+/**
+ * \brief Function to add an element to the end of the queue without waiting
+ *
+ * Complexity: O(1), lock-free
+ *
+ * \param queue The queue to add element to
+ * \param data  The data to enqueue
+ *
+ * \return 0 if enqueue operation was successful, or -1 if the queue is full
+ */
+int
+mpmcqueue_try_enqueue(MPMCQueue *queue, const void *data);
+
+/**
+ * \brief Function to remove an element from the front of a queue without waiting
+ *
+ * Complexity: O(1), lock-free
+ *
+ * \param queue The queue to remove element from
+ * \param data  The dequeued data
+ *
+ * \return 0 if dequeue operation was successful, or -1 if the queue is empty
+ */
+int
+mpmcqueue_try_dequeue(MPMCQueue *queue, void **data);
+
+/**
+ * \brief Function to add several elements to the end of the queue without waiting
+ *
+ * Finds how many consecutive slots from the current enqueue position are free, claims them all
+ * with a single compare-and-swap, then fills and publishes them. Elements enqueued by one call
+ * occupy consecutive positions, so no other producer's elements are interleaved with them.
+ *
+ * Complexity: O(count), lock-free
+ *
+ * \param queue The queue to add elements to
+ * \param data  Array of `count` data to enqueue
+ * \param count Number of elements to enqueue
+ *
+ * \return Number of elements enqueued, which is less than `count` if the queue filled up
+ */
+int
+mpmcqueue_try_enqueue_n(MPMCQueue *queue, void *const *data, int count);
+
+/**
+ * \brief Function to remove several elements from the front of a queue without waiting
+ *
+ * Claims as many consecutive published slots as are available, up to `count`, with a single
+ * compare-and-swap and copies their data into `data` in queue order.
+ *
+ * Complexity: O(count), lock-free
+ *
+ * \param queue The queue to remove elements from
+ * \param data  Array of room for `count` dequeued data
+ * \param count Maximum number of elements to dequeue
+ *
+ * \return Number of elements dequeued, which is 0 if the queue is empty
+ */
+int
+mpmcqueue_try_dequeue_n(MPMCQueue *queue, void **data, int count);
+
+/**
+ * \brief Function to add an element to the end of the queue, waiting while it is full
+ *
+ * Retries *mpmcqueue_try_enqueue*, spinning for MPMC_QUEUE_SPIN_COUNT attempts and then
+ * yielding the processor between attempts.
+ *
+ * \param queue The queue to add element to
+ * \param data  The data to enqueue
+ */
+void
+mpmcqueue_enqueue(MPMCQueue *queue, const void *data);
+
+/**
+ * \brief Function to remove an element from the front of a queue, waiting while it is empty
+ *
+ * Retries *mpmcqueue_try_dequeue* the same way *mpmcqueue_enqueue* retries.
+ *
+ * \param queue The queue to remove element from
+ * \param data  The dequeued data
+ */
+void
+mpmcqueue_dequeue(MPMCQueue *queue, void **data);
+
+/**
+ * MACRO that evaluates to the number of elements in the queue
+ *
+ * Exact only when no thread is operating on the queue; otherwise an approximation which counts
+ * claimed positions whose slots may not have been filled or emptied yet.
+ */
+#define mpmcqueue_size(queue) \
+	(atomic_load_explicit(&(queue)->tail, memory_order_relaxed) - \
+	 atomic_load_explicit(&(queue)->head, memory_order_relaxed))
+
+/**
+ * MACRO that evaluates to the maximum number of elements in the queue
+ */
+#define mpmcqueue_capacity(queue) ((queue)->capacity)
+
+#ifdef __cplusplus
+}
+#endif
+#endif // MPMCQUEUE_h
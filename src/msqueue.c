@@ -0,0 +1,250 @@
+/**
+ * \file msqueue.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of an unbounded lock-free concurrent queue ADT
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include <string.h>
+
+#include "hazard.h"
+#include "msqueue.h"
+#include "nodecache.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Queue Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+static MSQueue_Element *
+element_new(const void *data)
+{
+	MSQueue_Element *element;
+
+	if ((element = (MSQueue_Element *)allocator_alloc(&node_cache_allocator,
+	                                                  sizeof (MSQueue_Element))) == NULL) {
+		return NULL;
+	}
+
+	element->data = (void *)data;
+	atomic_init(&element->next, NULL);
+
+	return element;
+}
+
+static void
+element_reclaim(void *element)
+{
+	allocator_free(&node_cache_allocator, element, sizeof (MSQueue_Element));
+}
+
+int
+msqueue_init(MSQueue *queue, void (*destroy)(void *data))
+{
+	MSQueue_Element *dummy;
+
+	if ((dummy = element_new(NULL)) == NULL) {
+		return -1;
+	}
+
+	// Initialize the queue
+	atomic_init(&queue->head, dummy);
+	atomic_init(&queue->tail, dummy);
+	queue->destroy = destroy;
+
+	return 0;
+}
+
+void
+msqueue_destroy(MSQueue *queue)
+{
+	void *data;
+
+	// Remove each element, destroying its data
+	while (msqueue_dequeue(queue, &data) == 0) {
+		if (queue->destroy != NULL) {
+			queue->destroy(data);
+		}
+	}
+
+	// No other thread can see the dummy, so it is freed directly
+	element_reclaim(atomic_load(&queue->head));
+	hazard_collect();
+
+	// No operations permitted at this point -- clear memory as precaution
+	memset(queue, 0, sizeof (MSQueue));
+}
+
+// Link the chain `first` .. `last` after the last element with a single compare-and-swap
+static int
+link_chain(MSQueue *queue, MSQueue_Element *first, MSQueue_Element *last)
+{
+	MSQueue_Element *tail, *next;
+
+	for (;;) {
+		// Protect the tail, then make sure it is still the tail
+		tail = atomic_load(&queue->tail);
+
+		if (hazard_set(0, tail) != 0) {
+			return -1;
+		}
+
+		if (tail != atomic_load(&queue->tail)) {
+			continue;
+		}
+
+		next = atomic_load(&tail->next);
+
+		if (next != NULL) {
+			// The tail is lagging -- help move it along and retry
+			atomic_compare_exchange_strong(&queue->tail, &tail, next);
+			continue;
+		}
+
+		// Link the chain after the last element
+		if (atomic_compare_exchange_strong(&tail->next, &next, first)) {
+			break;
+		}
+	}
+
+	// Failure is fine: a helping thread moved the tail on, though possibly only as far as `first`,
+	// so it may still lag inside the chain until later operations advance it node by node
+	atomic_compare_exchange_strong(&queue->tail, &tail, last);
+
+	hazard_clear(0);
+
+	return 0;
+}
+
+static void
+chain_reclaim(MSQueue_Element *element)
+{
+	MSQueue_Element *next;
+
+	while (element != NULL) {
+		next = atomic_load_explicit(&element->next, memory_order_relaxed);
+		element_reclaim(element);
+		element = next;
+	}
+}
+
+int
+msqueue_enqueue(MSQueue *queue, const void *data)
+{
+	MSQueue_Element *new_element;
+
+	if ((new_element = element_new(data)) == NULL) {
+		return -1;
+	}
+
+	if (link_chain(queue, new_element, new_element) != 0) {
+		element_reclaim(new_element);
+		return -1;
+	}
+
+	return 0;
+}
+
+int
+msqueue_enqueue_n(MSQueue *queue, void *const *data, int count)
+{
+	MSQueue_Element *first = NULL, *last = NULL, *new_element;
+	int i;
+
+	if (count <= 0) {
+		return 0;
+	}
+
+	// Build a private chain first, so no other thread sees a partial batch
+	for (i = 0; i < count; i++) {
+		if ((new_element = element_new(data[i])) == NULL) {
+			chain_reclaim(first);
+			return -1;
+		}
+
+		if (last == NULL) {
+			first = new_element;
+		} else {
+			atomic_store_explicit(&last->next, new_element, memory_order_relaxed);
+		}
+
+		last = new_element;
+	}
+
+	if (link_chain(queue, first, last) != 0) {
+		chain_reclaim(first);
+		return -1;
+	}
+
+	return 0;
+}
+
+int
+msqueue_dequeue(MSQueue *queue, void **data)
+{
+	MSQueue_Element *head, *tail, *next;
+
+	for (;;) {
+		// Protect the dummy, then make sure it is still the dummy
+		head = atomic_load(&queue->head);
+
+		if (hazard_set(0, head) != 0) {
+			return -1;
+		}
+
+		if (head != atomic_load(&queue->head)) {
+			continue;
+		}
+
+		tail = atomic_load(&queue->tail);
+		next = atomic_load(&head->next);
+
+		// Protect the front element too; it is safe for as long as the dummy is still in place
+		hazard_set(1, next);
+
+		if (head != atomic_load(&queue->head)) {
+			continue;
+		}
+
+		if (next == NULL) {
+			// Nothing after the dummy
+			hazard_clear(0);
+			hazard_clear(1);
+			return -1;
+		}
+
+		if (head == tail) {
+			// The tail is lagging behind an element that is already linked in -- help it along
+			atomic_compare_exchange_strong(&queue->tail, &tail, next);
+			continue;
+		}
+
+		// Read the data before the element becomes the dummy and can be dequeued by others
+		*data = next->data;
+
+		if (atomic_compare_exchange_strong(&queue->head, &head, next)) {
+			break;
+		}
+	}
+
+	hazard_clear(0);
+	hazard_clear(1);
+
+	// The old dummy is unlinked, but other threads may still be looking at it
+	hazard_retire(head, element_reclaim);
+
+	return 0;
+}
+
+int
+msqueue_dequeue_n(MSQueue *queue, void **data, int count)
+{
+	int dequeued = 0;
+
+	// Each element is handed over by its own head swing; claiming several at once would need the
+	// head to jump past elements whose data other consumers might be reading
+	while (dequeued < count && msqueue_dequeue(queue, &data[dequeued]) == 0) {
+		dequeued++;
+	}
+
+	return dequeued;
+}
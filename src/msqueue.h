@@ -0,0 +1,155 @@
+/**
+ * \file msqueue.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Definitions of an unbounded lock-free concurrent queue ADT
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#ifndef MSQUEUE_h
+#define MSQUEUE_h
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdatomic.h>
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+/**
+ * \struct MSQueue_Element
+ * \brief Concurrent queue element
+ */
+typedef struct MSQueue_Element_s {
+	void *data;                              ///< Pointer to data
+
+	_Atomic(struct MSQueue_Element_s *) next; ///< Pointer to next element in queue
+
+} MSQueue_Element;
+
+/**
+ * \struct MSQueue
+ * \brief Unbounded lock-free queue safe for any number of threads (Michael-Scott queue)
+ *
+ * The queue is a singly linked-list that always starts with a dummy element, so `head` and
+ * `tail` are never NULL and producers and consumers only meet when the queue is empty. The data
+ * at the front of the queue is held by the element after the dummy; dequeuing it makes that
+ * element the new dummy. `tail` may trail the real last element: by one element after a single
+ * enqueue, or by any number of the elements linked in by *msqueue_enqueue_n*. Any thread that
+ * notices swings it forward one element at a time.
+ *
+ * Elements are only dereferenced under hazard pointers (see hazard.h), so the old dummy is
+ * retired on dequeue and freed once no thread refers to it. Element storage comes from the
+ * per-thread node cache (see nodecache.h).
+ */
+typedef struct MSQueue_s {
+	_Atomic(MSQueue_Element *) head; ///< Pointer to dummy element
+	_Atomic(MSQueue_Element *) tail; ///< Pointer to last element, or one trailing it
+
+	void (*destroy)(void *data); ///< Function pointer to destroy element
+
+} MSQueue;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Queue Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * \brief Function to initialize a concurrent queue
+ *
+ * \pre Must be called, and must return, before any thread uses the queue
+ *
+ * See *list_init* for the meaning of `destroy`.
+ *
+ * Complexity: O(1)
+ *
+ * \param queue   The queue to init
+ * \param destroy Function pointer to free data element memory
+ *
+ * \return 0 if the dummy element was allocated, otherwise -1
+ */
+int
+msqueue_init(MSQueue *queue, void (*destroy)(void *data));
+
+/**
+ * \brief Function to destroy a concurrent queue
+ *
+ * Dequeues every remaining element, calling the function passed as `destroy` to *msqueue_init*
+ * on its data provided `destroy` was not set to NULL, and frees the dummy element.
+ *
+ * \pre No other thread may be using the queue
+ *
+ * Complexity: O(n)
+ *
+ * \param queue The queue to destroy
+ */
+void
+msqueue_destroy(MSQueue *queue);
+
+/**
+ * \brief Function to add an element to the end of the queue
+ *
+ * Complexity: O(1), lock-free
+ *
+ * \param queue The queue to add element to
+ * \param data  The data to enqueue
+ *
+ * \return 0 if enqueue operation was successful, otherwise -1
+ */
+int
+msqueue_enqueue(MSQueue *queue, const void *data);
+
+/**
+ * \brief Function to remove an element from the front of a queue
+ *
+ * Complexity: O(1), lock-free
+ *
+ * \param queue The queue to remove element from
+ * \param data  The dequeued data
+ *
+ * \return 0 if dequeue operation was successful, or -1 if the queue is empty
+ */
+int
+msqueue_dequeue(MSQueue *queue, void **data);
+
+/**
+ * \brief Function to add several elements to the end of the queue at once
+ *
+ * The elements are linked into a private chain first, and the whole chain is then appended with a
+ * single compare-and-swap, so the batch appears to consumers atomically and in order.
+ *
+ * Complexity: O(count), lock-free
+ *
+ * \param queue The queue to add elements to
+ * \param data  Array of `count` data to enqueue
+ * \param count Number of elements to enqueue
+ *
+ * \return 0 if every element was enqueued, or -1 if none were
+ */
+int
+msqueue_enqueue_n(MSQueue *queue, void *const *data, int count);
+
+/**
+ * \brief Function to remove several elements from the front of a queue
+ *
+ * \note
+ * Elements are taken one at a time, so other consumers may take elements in between.
+ *
+ * Complexity: O(count), lock-free
+ *
+ * \param queue The queue to remove elements from
+ * \param data  Array of room for `count` dequeued data
+ * \param count Maximum number of elements to dequeue
+ *
+ * \return Number of elements dequeued, which is 0 if the queue is empty
+ */
+int
+msqueue_dequeue_n(MSQueue *queue, void **data, int count);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // MSQUEUE_h
@@ -0,0 +1,156 @@
+/**
+ * \file nodecache.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of a per-thread cache of recycled list elements
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "nodecache.h"
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+typedef struct Node_Cache_s {
+	void *head;               ///< Chain of cached blocks
+	int registered;           ///< Whether the thread exit handler has been registered
+
+	Node_Cache_Stats stats;   ///< Counters, count and watermarks
+
+} Node_Cache;
+
+static _Thread_local Node_Cache cache = {
+	NULL, 0, { 0, 0, 0, 0, NODE_CACHE_DEFAULT_LOW, NODE_CACHE_DEFAULT_HIGH }
+};
+
+static pthread_key_t cache_key;
+static pthread_once_t cache_key_once = PTHREAD_ONCE_INIT;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Node Cache Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+static void
+cache_trim(size_t count)
+{
+	void *block;
+
+	// Hand blocks back to the global allocator until only `count` remain
+	while (cache.stats.count > count) {
+		block = cache.head;
+		cache.head = *(void **)block;
+		free(block);
+		cache.stats.count--;
+	}
+}
+
+static void
+cache_thread_exit(void *unused)
+{
+	cache_trim(0);
+
+	// Blocks freed later in the exit (e.g. by other keys' destructors) register the handler again
+	cache.registered = 0;
+}
+
+static void
+cache_process_exit(void)
+{
+	cache_trim(0);
+}
+
+static void
+cache_key_create(void)
+{
+	pthread_key_create(&cache_key, cache_thread_exit);
+
+	// Key destructors do not run for the thread that returns from main or calls exit
+	atexit(cache_process_exit);
+}
+
+static void *
+cache_alloc(void *context, size_t size)
+{
+	void *block;
+
+	if (size > NODE_CACHE_OBJECT_SIZE) {
+		return malloc(size);
+	}
+
+	if (cache.head != NULL) {
+		// Hit -- pop a cached block
+		block = cache.head;
+		cache.head = *(void **)block;
+		cache.stats.count--;
+		cache.stats.hits++;
+
+		return block;
+	}
+
+	// Miss -- every cached block has the same size so the cache can take it back later
+	cache.stats.misses++;
+
+	return malloc(NODE_CACHE_OBJECT_SIZE);
+}
+
+static void
+cache_free(void *context, void *ptr, size_t size)
+{
+	if (size > NODE_CACHE_OBJECT_SIZE) {
+		free(ptr);
+		return;
+	}
+
+	// Make sure the cache is flushed when this thread exits
+	if (!cache.registered) {
+		pthread_once(&cache_key_once, cache_key_create);
+		pthread_setspecific(cache_key, &cache);
+		cache.registered = 1;
+	}
+
+	if (cache.stats.count >= cache.stats.high) {
+		cache.stats.trims += cache.stats.count - cache.stats.low;
+		cache_trim(cache.stats.low);
+	}
+
+	// Push the block onto the cache
+	*(void **)ptr = cache.head;
+	cache.head = ptr;
+	cache.stats.count++;
+}
+
+const Allocator node_cache_allocator = { cache_alloc, cache_free, NULL, NULL };
+
+int
+node_cache_set_watermarks(size_t low, size_t high)
+{
+	if (low > high || high == 0) {
+		return -1;
+	}
+
+	cache.stats.low = low;
+	cache.stats.high = high;
+
+	// Apply the new high watermark right away
+	if (cache.stats.count > high) {
+		cache.stats.trims += cache.stats.count - low;
+		cache_trim(low);
+	}
+
+	return 0;
+}
+
+void
+node_cache_stats(Node_Cache_Stats *stats)
+{
+	*stats = cache.stats;
+}
+
+void
+node_cache_flush(void)
+{
+	cache_trim(0);
+}
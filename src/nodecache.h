@@ -0,0 +1,111 @@
+/**
+ * \file nodecache.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Definitions of a per-thread cache of recycled list elements
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#ifndef NODECACHE_h
+#define NODECACHE_h
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+
+#include "allocator.h"
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+/**
+ * Size of each cached block; large enough for a List_Element, DList_Element or CList_Element
+ */
+#define NODE_CACHE_OBJECT_SIZE 32
+
+/**
+ * Default number of blocks the cache is trimmed down to when it overflows
+ */
+#define NODE_CACHE_DEFAULT_LOW 64
+
+/**
+ * Default number of blocks the cache may hold before it is trimmed
+ */
+#define NODE_CACHE_DEFAULT_HIGH 1024
+
+/**
+ * \struct Node_Cache_Stats
+ * \brief Counters describing the calling thread's node cache
+ */
+typedef struct Node_Cache_Stats_s {
+	unsigned long hits;   ///< Allocations served from the cache
+	unsigned long misses; ///< Allocations that fell through to *malloc*
+	unsigned long trims;  ///< Blocks handed back to *free* on reaching the high watermark
+
+	size_t count;         ///< Blocks currently held by the cache
+	size_t low;           ///< Low watermark
+	size_t high;          ///< High watermark
+
+} Node_Cache_Stats;
+
+/**
+ * Allocator that serves element-sized requests from the calling thread's node cache
+ *
+ * Requests of up to NODE_CACHE_OBJECT_SIZE bytes are popped from a thread-local free list, and
+ * freed blocks are pushed back onto it, so steady-state insert/remove churn never reaches the
+ * global allocator. Larger requests are forwarded to *malloc* and *free*. Blocks may be freed by
+ * a different thread than the one that allocated them; they join the freeing thread's cache.
+ */
+extern const Allocator node_cache_allocator;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Node Cache Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * \brief Function to set the watermarks of the calling thread's node cache
+ *
+ * When a free would grow the cache beyond `high` blocks, the cache is trimmed down to `low`
+ * blocks by handing the surplus back to *free*. Keeping `low` close to the thread's working set
+ * avoids misses after a trim, while `high` bounds the memory a thread may hoard.
+ *
+ * Complexity: O(1)
+ *
+ * \param low  Number of blocks kept after a trim
+ * \param high Maximum number of blocks held (must be at least `low`)
+ *
+ * \return 0 if the watermarks were set, otherwise -1
+ */
+int
+node_cache_set_watermarks(size_t low, size_t high);
+
+/**
+ * \brief Function to read the counters of the calling thread's node cache
+ *
+ * Complexity: O(1)
+ *
+ * \param stats Upon return, the cache's counters and watermarks
+ */
+void
+node_cache_stats(Node_Cache_Stats *stats);
+
+/**
+ * \brief Function to release every block held by the calling thread's node cache
+ *
+ * The cache is also flushed automatically when the thread exits, and for the thread that ends
+ * the process by returning from *main* or calling *exit*, when the process exits. Blocks freed
+ * after that point (e.g. by later *atexit* handlers) are left to the operating system. Counters
+ * are left untouched.
+ *
+ * Complexity: O(n) where n is the number of cached blocks
+ */
+void
+node_cache_flush(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // NODECACHE_h
@@ -0,0 +1,224 @@
+/**
+ * \file pool.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of a fixed-size object pool
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "pool.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Pool Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+static Pool_Slab *
+slab_map(size_t bytes)
+{
+	char *base;
+	size_t head;
+
+#ifdef MAP_HUGETLB
+	// Explicit huge pages, only available if the administrator reserved some
+	base = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+	            -1, 0);
+
+	if (base != MAP_FAILED) {
+		((Pool_Slab *)base)->mapped = bytes;
+		return (Pool_Slab *)base;
+	}
+#endif
+
+	// Over-map so the slab can be trimmed to huge page alignment
+	base = mmap(NULL, bytes + POOL_HUGEPAGE_SIZE, PROT_READ | PROT_WRITE,
+	            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	if (base == MAP_FAILED) {
+		return NULL;
+	}
+
+	head = -(size_t)base & (POOL_HUGEPAGE_SIZE - 1);
+
+	if (head > 0) {
+		munmap(base, head);
+	}
+
+	munmap(base + head + bytes, POOL_HUGEPAGE_SIZE - head);
+	base += head;
+
+#ifdef MADV_HUGEPAGE
+	// Advisory only -- the slab still works on normal pages if this is refused
+	madvise(base, bytes, MADV_HUGEPAGE);
+#endif
+
+	((Pool_Slab *)base)->mapped = bytes;
+
+	return (Pool_Slab *)base;
+}
+
+void
+pool_init(Pool *pool, size_t object_size, size_t slab_count)
+{
+	pool_init_flags(pool, object_size, slab_count, 0);
+}
+
+void
+pool_init_flags(Pool *pool, size_t object_size, size_t slab_count, int flags)
+{
+	size_t bytes;
+
+	// Objects double as free list links, so they must hold (and be aligned for) a pointer
+	if (object_size < sizeof (void *)) {
+		object_size = sizeof (void *);
+	}
+
+	object_size = (object_size + sizeof (void *) - 1) & ~(sizeof (void *) - 1);
+
+	if (slab_count == 0) {
+		slab_count = POOL_DEFAULT_SLAB_COUNT;
+	}
+
+	// Huge page slabs are whole huge pages, so fill them with as many objects as fit
+	if (flags & POOL_HUGEPAGE) {
+		bytes = sizeof (Pool_Slab) + object_size * slab_count;
+		bytes = (bytes + POOL_HUGEPAGE_SIZE - 1) & ~(POOL_HUGEPAGE_SIZE - 1);
+		slab_count = (bytes - sizeof (Pool_Slab)) / object_size;
+	}
+
+	// Initialize the pool
+	pool->object_size = object_size;
+	pool->slab_count = slab_count;
+	pool->flags = flags;
+	pool->slabs = NULL;
+	pool->free_list = NULL;
+	pool->cursor = NULL;
+	pool->limit = NULL;
+}
+
+void
+pool_destroy(Pool *pool)
+{
+	Pool_Slab *slab;
+
+	// Release every slab in one pass
+	while (pool->slabs != NULL) {
+		slab = pool->slabs;
+		pool->slabs = slab->next;
+
+		if (slab->mapped > 0) {
+			munmap(slab, slab->mapped);
+		} else {
+			free(slab);
+		}
+	}
+
+	// No operations permitted at this point -- clear memory as precaution
+	memset(pool, 0, sizeof (Pool));
+}
+
+void *
+pool_alloc(Pool *pool)
+{
+	Pool_Slab *slab = NULL;
+	size_t bytes;
+	void *object;
+
+	// Prefer recycled objects
+	if (pool->free_list != NULL) {
+		object = pool->free_list;
+		pool->free_list = *(void **)object;
+		return object;
+	}
+
+	// Allocate a new slab when the newest one is exhausted
+	if (pool->cursor == pool->limit) {
+		bytes = sizeof (Pool_Slab) + pool->object_size * pool->slab_count;
+
+		if (pool->flags & POOL_HUGEPAGE) {
+			bytes = (bytes + POOL_HUGEPAGE_SIZE - 1) & ~(POOL_HUGEPAGE_SIZE - 1);
+			slab = slab_map(bytes);
+		}
+
+		if (slab == NULL) {
+			if ((slab = (Pool_Slab *)malloc(bytes)) == NULL) {
+				return NULL;
+			}
+
+			slab->mapped = 0;
+		}
+
+		slab->next = pool->slabs;
+		pool->slabs = slab;
+
+		pool->cursor = (char *)(slab + 1);
+		pool->limit = pool->cursor + pool->object_size * pool->slab_count;
+	}
+
+	// Carve the next object from the slab
+	object = pool->cursor;
+	pool->cursor += pool->object_size;
+
+	return object;
+}
+
+void
+pool_free(Pool *pool, void *object)
+{
+	// Push the object onto the free list
+	*(void **)object = pool->free_list;
+	pool->free_list = object;
+}
+
+static void *
+pool_allocator_alloc(void *context, size_t size)
+{
+	Pool *pool = (Pool *)context;
+
+	if (size > pool->object_size) {
+		return NULL;
+	}
+
+	return pool_alloc(pool);
+}
+
+static void
+pool_allocator_free(void *context, void *ptr, size_t size)
+{
+	pool_free((Pool *)context, ptr);
+}
+
+Allocator
+pool_allocator(Pool *pool)
+{
+	Allocator allocator = { pool_allocator_alloc, pool_allocator_free, NULL, pool };
+
+	return allocator;
+}
+
+static void
+pool_allocator_release(void *context)
+{
+	pool_destroy((Pool *)context);
+	free(context);
+}
+
+int
+pool_arena_allocator(Allocator *allocator, size_t object_size, size_t slab_count, int flags)
+{
+	Pool *pool;
+
+	// The arena owns its pool, which goes away with it on release
+	if ((pool = (Pool *)malloc(sizeof (Pool))) == NULL) {
+		return -1;
+	}
+
+	pool_init_flags(pool, object_size, slab_count, flags);
+
+	*allocator = pool_allocator(pool);
+	allocator->release = pool_allocator_release;
+
+	return 0;
+}
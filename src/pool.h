@@ -0,0 +1,197 @@
+/**
+ * \file pool.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Definitions of a fixed-size object pool
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#ifndef POOL_h
+#define POOL_h
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+
+#include "allocator.h"
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+/**
+ * Default number of objects carved from each slab when *pool_init* is given a count of 0
+ */
+#define POOL_DEFAULT_SLAB_COUNT 256
+
+/**
+ * Flag asking *pool_init_flags* to back slabs with huge pages where the system allows it
+ */
+#define POOL_HUGEPAGE 0x1
+
+/**
+ * Size and alignment of the slabs of a POOL_HUGEPAGE pool
+ */
+#define POOL_HUGEPAGE_SIZE (2UL * 1024 * 1024)
+
+/**
+ * \struct Pool_Slab
+ * \brief Header of a block of memory that objects are carved from
+ */
+typedef struct Pool_Slab_s {
+	struct Pool_Slab_s *next; ///< Pointer to next slab owned by the pool
+	size_t mapped;            ///< Length of the slab's mapping, or 0 if it came from malloc
+
+} Pool_Slab;
+
+/**
+ * \struct Pool
+ * \brief Fixed-size object pool
+ *
+ * Objects are carved from large slabs and recycled through an internal free list, so that once
+ * the pool has grown to its working size *pool_alloc* and *pool_free* never touch the system
+ * allocator. All slabs are released in one go by *pool_destroy*.
+ */
+typedef struct Pool_s {
+	size_t object_size; ///< Size of each object (rounded up to pointer alignment)
+	size_t slab_count;  ///< Number of objects carved from each slab
+	int flags;          ///< POOL_* flags given at init
+
+	Pool_Slab *slabs;   ///< Chain of slabs owned by the pool
+	void *free_list;    ///< Chain of objects returned by *pool_free*
+
+	char *cursor;       ///< Next uncarved object in the newest slab
+	char *limit;        ///< End of the newest slab
+
+} Pool;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Pool Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * \brief Function to initialize an object pool
+ *
+ * \pre Must be called before the pool can be used by any other operation
+ *
+ * No memory is reserved until the first call to *pool_alloc*.
+ *
+ * Complexity: O(1)
+ *
+ * \param pool        The pool to init
+ * \param object_size Size in bytes of each object handed out by the pool
+ * \param slab_count  Number of objects per slab, or 0 for POOL_DEFAULT_SLAB_COUNT
+ */
+void
+pool_init(Pool *pool, size_t object_size, size_t slab_count);
+
+/**
+ * \brief Function to initialize an object pool with flags
+ *
+ * \pre Must be called before the pool can be used by any other operation
+ *
+ * Same as *pool_init*, with `flags` selecting how slabs are obtained:
+ *
+ * - POOL_HUGEPAGE: slabs are rounded up to a multiple of POOL_HUGEPAGE_SIZE (with `slab_count`
+ *   raised to fill them) and mapped with *mmap*. Explicit huge pages (MAP_HUGETLB) are tried
+ *   first, then an aligned mapping advised with MADV_HUGEPAGE for transparent huge pages. If
+ *   neither is supported the pool quietly falls back to normal pages, and to *malloc* if the
+ *   mapping fails altogether.
+ *
+ * Complexity: O(1)
+ *
+ * \param pool        The pool to init
+ * \param object_size Size in bytes of each object handed out by the pool
+ * \param slab_count  Number of objects per slab, or 0 for POOL_DEFAULT_SLAB_COUNT
+ * \param flags       Bitwise OR of POOL_* flags, or 0
+ */
+void
+pool_init_flags(Pool *pool, size_t object_size, size_t slab_count, int flags);
+
+/**
+ * \brief Function to destroy an object pool
+ *
+ * Releases every slab owned by the pool in one pass, regardless of whether the objects carved
+ * from them were returned with *pool_free*.
+ *
+ * \note
+ * No operation is permitted after *pool_destroy* is called unless *pool_init* is called again.
+ * Any object obtained from the pool is invalid after this call.
+ *
+ * Complexity: O(s) where s is the number of slabs
+ *
+ * \param pool The pool to destroy
+ */
+void
+pool_destroy(Pool *pool);
+
+/**
+ * \brief Function to take an object from the pool
+ *
+ * Recycled objects are handed out first; otherwise the next object is carved from the newest
+ * slab, and a new slab is allocated when that one is exhausted.
+ *
+ * Complexity: O(1)
+ *
+ * \param pool The pool to allocate from
+ *
+ * \return Pointer to an object of `object_size` bytes, or NULL if a slab could not be allocated
+ */
+void *
+pool_alloc(Pool *pool);
+
+/**
+ * \brief Function to return an object to the pool
+ *
+ * The object is pushed onto the pool's free list for reuse; no memory is returned to the system
+ * until *pool_destroy* is called.
+ *
+ * Complexity: O(1)
+ *
+ * \param pool   The pool the object was allocated from
+ * \param object The object to return
+ */
+void
+pool_free(Pool *pool, void *object);
+
+/**
+ * \brief Function to obtain an allocator descriptor backed by a pool
+ *
+ * The returned allocator hands out objects from `pool` and returns them to it, so it can be
+ * passed to *list_init_allocator*, *dlist_init_allocator* or *clist_init_allocator*. Requests
+ * larger than the pool's object size fail by returning NULL.
+ *
+ * Complexity: O(1)
+ *
+ * \param pool The pool to allocate from, which must outlive every user of the allocator
+ *
+ * \return Allocator descriptor whose context is `pool`
+ */
+Allocator
+pool_allocator(Pool *pool);
+
+/**
+ * \brief Function to create a private pool and describe it as an arena allocator
+ *
+ * Allocates and initializes a pool that belongs to the returned allocator alone. Unlike
+ * *pool_allocator*, the descriptor has a `release` function, so an ADT destroyed with it drops
+ * every element by releasing the pool's slabs in one pass instead of freeing them one by one.
+ *
+ * Complexity: O(1)
+ *
+ * \param allocator   Upon return, the arena allocator descriptor
+ * \param object_size Size in bytes of each object handed out by the arena
+ * \param slab_count  Number of objects per slab, or 0 for POOL_DEFAULT_SLAB_COUNT
+ * \param flags       Bitwise OR of POOL_* flags passed to *pool_init_flags*, or 0
+ *
+ * \return 0 if the arena was created, otherwise -1
+ */
+int
+pool_arena_allocator(Allocator *allocator, size_t object_size, size_t slab_count, int flags);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // POOL_h
@@ -24,3 +24,15 @@ queue_dequeue(Queue *queue, void **data)
 {
 	return list_remove_next(queue, NULL, data);
 }
+
+int
+queue_enqueue_n(Queue *queue, void *const *data, int count)
+{
+	return list_insert_next_n(queue, list_tail(queue), data, count);
+}
+
+int
+queue_dequeue_n(Queue *queue, void **data, int count)
+{
+	return list_remove_next_n(queue, NULL, data, count);
+}
@@ -31,6 +31,27 @@ typedef List Queue;
  */
 #define queue_init list_init
 
+/**
+ * MACRO to init the queue with a custom element allocator. Functionally same as *list_init_allocator*
+ */
+#define queue_init_allocator list_init_allocator
+
+/**
+ * MACRO to init the queue with fixed-size values stored inline. Functionally same as
+ * *list_init_inline*; *queue_dequeue* then copies into the buffer `*data` points to
+ */
+#define queue_init_inline list_init_inline
+
+/**
+ * MACRO to init the queue with a node pool. Functionally same as *list_init_pool*
+ */
+#define queue_init_pool list_init_pool
+
+/**
+ * MACRO to init the queue with a private element arena. Functionally same as *list_init_arena*
+ */
+#define queue_init_arena list_init_arena
+
 /**
  * MACRO to destroy the queue. Functionally same as *list_destroy*
  */
@@ -66,6 +87,36 @@ queue_enqueue(Queue *queue, const void *data);
 int
 queue_dequeue(Queue *queue, void **data);
 
+/**
+ * \brief Function to add several elements to the end of the queue at once
+ * 
+ * Enqueues `data[0]` to `data[count - 1]` in that order, splicing them onto the tail of the
+ * list with a single link update. Either all of them are enqueued or none are.
+ * 
+ * \param queue The queue to add elements to
+ * \param data  Array of `count` data to enqueue
+ * \param count Number of elements to enqueue
+ * 
+ * \return 0 if enqueue operation was successful, otherwise -1
+ */
+int
+queue_enqueue_n(Queue *queue, void *const *data, int count);
+
+/**
+ * \brief Function to remove several elements from the front of a queue at once
+ * 
+ * Dequeues up to `count` elements into `data[0]`, `data[1]`, ... in queue order, unlinking
+ * them from the head of the list with a single link update.
+ * 
+ * \param queue The queue to remove elements from
+ * \param data  Array of room for `count` dequeued data
+ * \param count Maximum number of elements to dequeue
+ * 
+ * \return Number of elements dequeued, which is less than `count` if the queue ran out
+ */
+int
+queue_dequeue_n(Queue *queue, void **data, int count);
+
 /**
  * MACRO that provides mechanism to inspect the element at front of queue
  */
@@ -0,0 +1,62 @@
+/**
+ * \file ring.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of the buffer management shared by the ring-buffer ADTs
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "ring.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Ring Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int
+ring_resize(void ***data, size_t *capacity, size_t *head, size_t size, size_t new_capacity)
+{
+	void **buffer;
+	size_t first;
+
+	if ((buffer = (void **)malloc(new_capacity * sizeof (void *))) == NULL) {
+		return -1;
+	}
+
+	// Unwrap the elements so the first one lands in slot 0
+	if (size > 0) {
+		first = *capacity - *head;
+
+		if (first >= size) {
+			memcpy(buffer, *data + *head, size * sizeof (void *));
+		} else {
+			memcpy(buffer, *data + *head, first * sizeof (void *));
+			memcpy(buffer + first, *data, (size - first) * sizeof (void *));
+		}
+	}
+
+	free(*data);
+
+	*data = buffer;
+	*capacity = new_capacity;
+	*head = 0;
+
+	return 0;
+}
+
+size_t
+ring_round_capacity(size_t capacity, size_t minimum)
+{
+	size_t rounded = minimum;
+
+	while (rounded < capacity) {
+		if (rounded > ((size_t)-1 / sizeof (void *)) / 2) {
+			return 0;
+		}
+
+		rounded *= 2;
+	}
+
+	return rounded;
+}
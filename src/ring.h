@@ -0,0 +1,59 @@
+/**
+ * \file ring.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Buffer management shared by the ring-buffer ADTs (RQueue and Deque)
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#ifndef RING_h
+#define RING_h
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Ring Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * \brief Function to move a ring's elements into a new buffer of another capacity
+ *
+ * Unwraps the `size` elements starting at slot `*head` so the first one lands in slot 0 of the
+ * new buffer, frees the old buffer and updates `*data`, `*capacity` and `*head`. On failure the
+ * ring is left as it was.
+ *
+ * Complexity: O(size)
+ *
+ * \param data         The ring's circular buffer of data pointers
+ * \param capacity     Number of slots in `*data` (0 or a power of two)
+ * \param head         Slot holding the first element
+ * \param size         Number of elements in the ring
+ * \param new_capacity Number of slots in the new buffer (a power of two, at least `size`)
+ *
+ * \return 0 if the buffer was replaced, otherwise -1
+ */
+int
+ring_resize(void ***data, size_t *capacity, size_t *head, size_t size, size_t new_capacity);
+
+/**
+ * \brief Function to round a requested capacity up to a power of two
+ *
+ * Complexity: O(log n)
+ *
+ * \param capacity Number of slots requested
+ * \param minimum  Smallest capacity to hand out (a power of two)
+ *
+ * \return The smallest power of two not below `capacity` or `minimum`, or 0 if a buffer of that
+ *         many data pointers could not be addressed
+ */
+size_t
+ring_round_capacity(size_t capacity, size_t minimum);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // RING_h
@@ -0,0 +1,98 @@
+/**
+ * \file rqueue.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of a generic ring-buffer queue ADT
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "rqueue.h"
+#include "ring.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Queue Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+static int
+resize(RQueue *queue, size_t capacity)
+{
+	return ring_resize(&queue->data, &queue->capacity, &queue->head, queue->size, capacity);
+}
+
+void
+rqueue_init(RQueue *queue, void (*destroy)(void *data))
+{
+	// Initialize the queue
+	queue->size = 0;
+	queue->destroy = destroy;
+	queue->data = NULL;
+	queue->capacity = 0;
+	queue->head = 0;
+}
+
+void
+rqueue_destroy(RQueue *queue)
+{
+	void *data;
+
+	// Destroy the data of each element, front of the queue first
+	if (queue->destroy != NULL) {
+		while (rqueue_dequeue(queue, &data) == 0) {
+			queue->destroy(data);
+		}
+	}
+
+	free(queue->data);
+
+	// No operations permitted at this point -- clear memory as precaution
+	memset(queue, 0, sizeof (RQueue));
+}
+
+int
+rqueue_reserve(RQueue *queue, size_t capacity)
+{
+	size_t rounded;
+
+	if (capacity <= queue->capacity) {
+		return 0;
+	}
+
+	if ((rounded = ring_round_capacity(capacity, RQUEUE_DEFAULT_CAPACITY)) == 0) {
+		return -1;
+	}
+
+	return resize(queue, rounded);
+}
+
+int
+rqueue_enqueue(RQueue *queue, const void *data)
+{
+	// Double the buffer when it is full
+	if ((size_t)queue->size == queue->capacity) {
+		if (resize(queue, queue->capacity == 0 ? RQUEUE_DEFAULT_CAPACITY : queue->capacity * 2) != 0) {
+			return -1;
+		}
+	}
+
+	queue->data[(queue->head + queue->size) & (queue->capacity - 1)] = (void *)data;
+	queue->size++;
+
+	return 0;
+}
+
+int
+rqueue_dequeue(RQueue *queue, void **data)
+{
+	// Do not allow dequeue from empty queue
+	if (queue->size == 0) {
+		return -1;
+	}
+
+	*data = queue->data[queue->head];
+	queue->head = (queue->head + 1) & (queue->capacity - 1);
+	queue->size--;
+
+	return 0;
+}
@@ -0,0 +1,144 @@
+/**
+ * \file rqueue.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Definitions of a generic ring-buffer queue ADT
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#ifndef RQUEUE_h
+#define RQUEUE_h
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+/**
+ * Number of slots allocated by the first enqueue onto a queue that has no storage yet
+ */
+#define RQUEUE_DEFAULT_CAPACITY 16
+
+/**
+ * \struct RQueue
+ * \brief Generic queue holding its data pointers in a circular buffer
+ *
+ * The buffer's capacity is always a power of two, so positions wrap with a mask instead of a
+ * division. When the buffer is full it is doubled and the elements are unwrapped into the new
+ * one; once the queue has reached its working size *rqueue_enqueue* and *rqueue_dequeue* never
+ * allocate.
+ */
+typedef struct RQueue_s {
+	int size; ///< Number of elements in queue
+
+	void (*destroy)(void *data); ///< Function pointer to destroy element
+
+	void **data;     ///< Circular buffer of data pointers
+	size_t capacity; ///< Number of slots in `data` (0 or a power of two)
+	size_t head;     ///< Slot holding the front of the queue
+
+} RQueue;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Queue Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * \brief Function to initialize a ring-buffer queue
+ *
+ * \pre Must be called before queue can be used by any other operation
+ *
+ * No storage is allocated until the first enqueue (or *rqueue_reserve*). See *list_init* for
+ * the meaning of `destroy`.
+ *
+ * Complexity: O(1)
+ *
+ * \param queue   The queue to init
+ * \param destroy Function pointer to free data element memory
+ */
+void
+rqueue_init(RQueue *queue, void (*destroy)(void *data));
+
+/**
+ * \brief Function to destroy a ring-buffer queue
+ *
+ * Calls the function passed as `destroy` to *rqueue_init* once for each element still in the
+ * queue, provided `destroy` was not set to NULL, and frees the buffer.
+ *
+ * \note
+ * No operation is permitted after *rqueue_destroy* is called unless *rqueue_init* is called
+ * again.
+ *
+ * Complexity: O(n), or O(1) if `destroy` is NULL
+ *
+ * \param queue The queue to destroy
+ */
+void
+rqueue_destroy(RQueue *queue);
+
+/**
+ * \brief Function to reserve storage in a ring-buffer queue
+ *
+ * Grows the buffer so that it holds at least `capacity` elements, rounded up to a power of two.
+ * Never shrinks the buffer.
+ *
+ * Complexity: O(n)
+ *
+ * \param queue    The queue to reserve storage in
+ * \param capacity Number of elements to make room for
+ *
+ * \return 0 if the storage is available, otherwise -1
+ */
+int
+rqueue_reserve(RQueue *queue, size_t capacity);
+
+/**
+ * \brief Function to add an element to the end of the queue
+ *
+ * Complexity: O(1) amortized
+ *
+ * \param queue The queue to add element to
+ * \param data  The data to enqueue
+ *
+ * \return 0 if enqueue operation was successful, otherwise -1
+ */
+int
+rqueue_enqueue(RQueue *queue, const void *data);
+
+/**
+ * \brief Function to remove an element from the front of a queue
+ *
+ * Complexity: O(1)
+ *
+ * \param queue The queue to remove element from
+ * \param data  The dequeued data
+ *
+ * \return 0 if dequeue operation was successful, otherwise -1
+ */
+int
+rqueue_dequeue(RQueue *queue, void **data);
+
+/**
+ * MACRO that provides mechanism to inspect the element at front of queue
+ */
+#define rqueue_peek(queue) ((queue)->size == 0 ? NULL : (queue)->data[(queue)->head])
+
+/**
+ * MACRO that evaluates to the number of elements in the queue
+ */
+#define rqueue_size(queue) ((queue)->size)
+
+/**
+ * MACRO that evaluates to the number of elements the queue can hold without growing
+ */
+#define rqueue_capacity(queue) ((queue)->capacity)
+
+#ifdef __cplusplus
+}
+#endif
+#endif // RQUEUE_h
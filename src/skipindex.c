@@ -0,0 +1,280 @@
+/**
+ * \file skipindex.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of a skip-list index over a sorted doubly linked-list
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include <stdlib.h>
+
+#include "skipindex.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Index Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+static SkipIndex_Node *
+node_new(DList_Element *element, int height)
+{
+	SkipIndex_Node *node;
+	int i;
+
+	if ((node = (SkipIndex_Node *)malloc(sizeof (SkipIndex_Node) +
+	                                     height * sizeof (SkipIndex_Node *))) == NULL) {
+		return NULL;
+	}
+
+	node->element = element;
+	node->height = height;
+
+	for (i = 0; i < height; i++) {
+		node->next[i] = NULL;
+	}
+
+	return node;
+}
+
+// Draw a tower height: 0 with probability 3/4, then each further level with probability 1/4
+static int
+random_height(SkipIndex *index)
+{
+	uint64_t bits;
+	int height = 0;
+
+	// xorshift64*
+	index->seed ^= index->seed >> 12;
+	index->seed ^= index->seed << 25;
+	index->seed ^= index->seed >> 27;
+	bits = index->seed * 0x2545f4914f6cdd1dULL;
+
+	while ((bits & 3) == 0 && height < SKIP_INDEX_MAX_LEVEL) {
+		height++;
+		bits >>= 2;
+	}
+
+	return height;
+}
+
+// Descend to the last tower at each level whose data is less than `data` (or not greater than it
+// when `inclusive`), recording it in `update` if given; returns the last such tower at level 0
+static SkipIndex_Node *
+descend(const SkipIndex *index, const void *data, int inclusive, SkipIndex_Node **update)
+{
+	SkipIndex_Node *node = index->head, *next;
+	int level, order;
+
+	for (level = index->level - 1; level >= 0; level--) {
+		while ((next = node->next[level]) != NULL) {
+			order = index->compare(dlist_data(next->element), data);
+
+			if (order > 0 || (order == 0 && !inclusive)) {
+				break;
+			}
+
+			node = next;
+		}
+
+		if (update != NULL) {
+			update[level] = node;
+		}
+	}
+
+	return node;
+}
+
+int
+skipindex_init(SkipIndex *index, DList *list, int (*compare)(const void *key1, const void *key2))
+{
+	SkipIndex_Node *last[SKIP_INDEX_MAX_LEVEL], *node;
+	DList_Element *element;
+	int height, i;
+
+	// Initialize the index
+	index->list = list;
+	index->compare = compare;
+	index->level = 0;
+	index->seed = 0x9e3779b97f4a7c15ULL;
+
+	if ((index->head = node_new(NULL, SKIP_INDEX_MAX_LEVEL)) == NULL) {
+		return -1;
+	}
+
+	for (i = 0; i < SKIP_INDEX_MAX_LEVEL; i++) {
+		last[i] = index->head;
+	}
+
+	// The list is already sorted, so each new tower is appended at every one of its levels
+	for (element = dlist_head(list); element != NULL; element = dlist_next(element)) {
+		if ((height = random_height(index)) == 0) {
+			continue;
+		}
+
+		if ((node = node_new(element, height)) == NULL) {
+			skipindex_destroy(index);
+			return -1;
+		}
+
+		for (i = 0; i < height; i++) {
+			last[i]->next[i] = node;
+			last[i] = node;
+		}
+
+		if (height > index->level) {
+			index->level = height;
+		}
+	}
+
+	return 0;
+}
+
+void
+skipindex_destroy(SkipIndex *index)
+{
+	SkipIndex_Node *node, *next;
+
+	if (index->head == NULL) {
+		return;
+	}
+
+	// Every tower is linked at level 0
+	for (node = index->head->next[0]; node != NULL; node = next) {
+		next = node->next[0];
+		free(node);
+	}
+
+	free(index->head);
+
+	// Clear the structure as a precaution
+	index->head = NULL;
+	index->level = 0;
+}
+
+DList_Element *
+skipindex_lower_bound(const SkipIndex *index, const void *data)
+{
+	SkipIndex_Node *node = descend(index, data, 0, NULL);
+	DList_Element *element;
+
+	// Finish with a walk along the list from the last tower before the key
+	element = node == index->head ? dlist_head(index->list) : node->element;
+
+	while (element != NULL && index->compare(dlist_data(element), data) < 0) {
+		element = dlist_next(element);
+	}
+
+	return element;
+}
+
+DList_Element *
+skipindex_search(const SkipIndex *index, const void *data)
+{
+	DList_Element *element = skipindex_lower_bound(index, data);
+
+	if (element == NULL || index->compare(dlist_data(element), data) != 0) {
+		return NULL;
+	}
+
+	return element;
+}
+
+int
+skipindex_insert(SkipIndex *index, const void *data)
+{
+	SkipIndex_Node *update[SKIP_INDEX_MAX_LEVEL], *node = NULL;
+	DList_Element *element, *next;
+	int height, i, result;
+
+	// Find the last element not greater than the data
+	element = descend(index, data, 1, update)->element;
+
+	if (element == NULL) {
+		element = dlist_head(index->list);
+
+		if (element != NULL && index->compare(dlist_data(element), data) > 0) {
+			element = NULL;
+		}
+	}
+
+	if (element != NULL) {
+		while ((next = dlist_next(element)) != NULL && index->compare(dlist_data(next), data) <= 0) {
+			element = next;
+		}
+	}
+
+	// Allocate the tower first so a failure leaves the list untouched
+	height = random_height(index);
+
+	if (height > 0 && (node = node_new(NULL, height)) == NULL) {
+		return -1;
+	}
+
+	if (element == NULL && dlist_size(index->list) > 0) {
+		result = dlist_insert_prev(index->list, dlist_head(index->list), data);
+	} else {
+		result = dlist_insert_next(index->list, element, data);
+	}
+
+	if (result != 0) {
+		free(node);
+		return -1;
+	}
+
+	if (node == NULL) {
+		return 0;
+	}
+
+	node->element = element == NULL ? dlist_head(index->list) : dlist_next(element);
+
+	for (i = index->level; i < height; i++) {
+		update[i] = index->head;
+	}
+
+	for (i = 0; i < height; i++) {
+		node->next[i] = update[i]->next[i];
+		update[i]->next[i] = node;
+	}
+
+	if (height > index->level) {
+		index->level = height;
+	}
+
+	return 0;
+}
+
+int
+skipindex_remove(SkipIndex *index, DList_Element *element, void **data)
+{
+	SkipIndex_Node *update[SKIP_INDEX_MAX_LEVEL], *node, *previous;
+	int i;
+
+	if (element == NULL || dlist_size(index->list) == 0) {
+		return -1;
+	}
+
+	// Towers of equal data follow the last tower before them; look for the element's own
+	descend(index, dlist_data(element), 0, update);
+
+	node = index->level > 0 ? update[0]->next[0] : NULL;
+
+	while (node != NULL && node->element != element &&
+	       index->compare(dlist_data(node->element), dlist_data(element)) == 0) {
+		node = node->next[0];
+	}
+
+	if (node != NULL && node->element == element) {
+		for (i = 0; i < node->height; i++) {
+			for (previous = update[i]; previous->next[i] != node; previous = previous->next[i])
+				;
+
+			previous->next[i] = node->next[i];
+		}
+
+		free(node);
+
+		while (index->level > 0 && index->head->next[index->level - 1] == NULL) {
+			index->level--;
+		}
+	}
+
+	return dlist_remove(index->list, element, data);
+}
@@ -0,0 +1,165 @@
+/**
+ * \file skipindex.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Definitions of a skip-list index over a sorted doubly linked-list
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#ifndef SKIPINDEX_h
+#define SKIPINDEX_h
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+#include "dlist.h"
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+/**
+ * Maximum number of tower levels above the list
+ */
+#define SKIP_INDEX_MAX_LEVEL 32
+
+/**
+ * \struct SkipIndex_Node
+ * \brief Tower of forward links standing on one element of the indexed list
+ */
+typedef struct SkipIndex_Node_s {
+	DList_Element *element;          ///< Element of the list the tower stands on
+	int height;                      ///< Number of levels in the tower
+
+	struct SkipIndex_Node_s *next[]; ///< Next tower at each level, or NULL
+
+} SkipIndex_Node;
+
+/**
+ * \struct SkipIndex
+ * \brief Skip-list index over a doubly linked-list kept in sorted order
+ *
+ * The list itself is the bottom level of the skip list, so its elements and their `next` and
+ * `prev` links are not touched and iterating it with *dlist_next* and *dlist_prev* works as
+ * before. About one element in four gets a tower of randomized height on top of it; each level
+ * up holds about a quarter of the towers of the level below. A search descends the towers to the
+ * last one before the key and finishes with a short walk along the list.
+ *
+ * While an index is attached, elements must only be inserted and removed through it, since the
+ * list does not know about the towers standing on its elements.
+ */
+typedef struct SkipIndex_s {
+	DList *list; ///< The indexed list
+
+	int (*compare)(const void *key1, const void *key2); ///< Ordering of the list's data
+
+	SkipIndex_Node *head; ///< Sentinel tower with SKIP_INDEX_MAX_LEVEL levels
+	int level;            ///< Number of levels currently in use
+	uint64_t seed;        ///< State of the generator drawing tower heights
+
+} SkipIndex;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Index Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * \brief Function to build a skip-list index over a sorted doubly linked-list
+ *
+ * \pre `list` must be sorted in ascending order as defined by `compare`, for example by
+ * *dlist_sort* with the same function
+ *
+ * Complexity: O(n)
+ *
+ * \param index   The index to init
+ * \param list    The sorted doubly linked-list to index
+ * \param compare Function returning less than, equal to or greater than 0 when the data `key1`
+ *                is less than, equal to or greater than the data `key2` (as for *qsort*)
+ *
+ * \return 0 if the index was built, otherwise -1
+ */
+int
+skipindex_init(SkipIndex *index, DList *list, int (*compare)(const void *key1, const void *key2));
+
+/**
+ * \brief Function to destroy a skip-list index
+ *
+ * Frees the towers only; the list and its elements are left as they are.
+ *
+ * Complexity: O(n)
+ *
+ * \param index The index to destroy
+ */
+void
+skipindex_destroy(SkipIndex *index);
+
+/**
+ * \brief Function to find the first element not less than a key
+ *
+ * Complexity: O(log n) expected
+ *
+ * \param index The index to search
+ * \param data  The key to compare the list's data with
+ *
+ * \return The first element whose data is not less than `data`, or NULL if there is none
+ */
+DList_Element *
+skipindex_lower_bound(const SkipIndex *index, const void *data);
+
+/**
+ * \brief Function to find the first element equal to a key
+ *
+ * Complexity: O(log n) expected
+ *
+ * \param index The index to search
+ * \param data  The key to compare the list's data with
+ *
+ * \return The first element whose data compares equal to `data`, or NULL if there is none
+ */
+DList_Element *
+skipindex_search(const SkipIndex *index, const void *data);
+
+/**
+ * \brief Function to insert data into the indexed list at its sorted position
+ *
+ * The new element goes after any elements that compare equal to `data`, so equal data keeps the
+ * order it was inserted in.
+ *
+ * Complexity: O(log n) expected
+ *
+ * \param index The index of the list to insert into
+ * \param data  The data to insert
+ *
+ * \return 0 if inserting was successful, otherwise -1
+ */
+int
+skipindex_insert(SkipIndex *index, const void *data);
+
+/**
+ * \brief Function to remove an element from the indexed list
+ *
+ * Takes down the element's tower, if it has one, then removes it as *dlist_remove* does.
+ *
+ * Complexity: O(log n) expected
+ *
+ * \param index   The index of the list to remove from
+ * \param element Pointer to element to remove
+ * \param data    Pointer to data removed
+ *
+ * \return 0 if removing was successful, otherwise -1
+ */
+int
+skipindex_remove(SkipIndex *index, DList_Element *element, void **data);
+
+/**
+ * MACRO that evaluates to the indexed list
+ */
+#define skipindex_list(index) ((index)->list)
+
+#ifdef __cplusplus
+}
+#endif
+#endif // SKIPINDEX_h
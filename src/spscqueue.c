@@ -0,0 +1,187 @@
+/**
+ * \file spscqueue.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of a bounded lock-free single-producer/single-consumer queue
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "spscqueue.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Queue Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int
+spscqueue_init(SPSCQueue *queue, void (*destroy)(void *data), size_t capacity)
+{
+	size_t rounded = 1;
+
+	while (rounded < capacity) {
+		if (rounded > ((size_t)-1 / sizeof (void *)) / 2) {
+			return -1;
+		}
+
+		rounded *= 2;
+	}
+
+	if ((queue->data = (void **)malloc(rounded * sizeof (void *))) == NULL) {
+		return -1;
+	}
+
+	// Initialize the queue
+	queue->capacity = rounded;
+	queue->destroy = destroy;
+
+	atomic_init(&queue->tail, 0);
+	atomic_init(&queue->head, 0);
+	queue->head_cache = 0;
+	queue->tail_cache = 0;
+
+	return 0;
+}
+
+void
+spscqueue_destroy(SPSCQueue *queue)
+{
+	void *data;
+
+	// Destroy the data of each element, front of the queue first
+	if (queue->destroy != NULL) {
+		while (spscqueue_dequeue(queue, &data) == 0) {
+			queue->destroy(data);
+		}
+	}
+
+	free(queue->data);
+
+	// No operations permitted at this point -- clear memory as precaution
+	memset(queue, 0, sizeof (SPSCQueue));
+}
+
+int
+spscqueue_enqueue(SPSCQueue *queue, const void *data)
+{
+	size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+
+	// Only look at the consumer's index when the cached one says the ring is full
+	if (tail - queue->head_cache == queue->capacity) {
+		queue->head_cache = atomic_load_explicit(&queue->head, memory_order_acquire);
+
+		if (tail - queue->head_cache == queue->capacity) {
+			return -1;
+		}
+	}
+
+	queue->data[tail & (queue->capacity - 1)] = (void *)data;
+
+	// Publish the slot to the consumer
+	atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+
+	return 0;
+}
+
+int
+spscqueue_dequeue(SPSCQueue *queue, void **data)
+{
+	size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+
+	// Only look at the producer's index when the cached one says the ring is empty
+	if (head == queue->tail_cache) {
+		queue->tail_cache = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+		if (head == queue->tail_cache) {
+			return -1;
+		}
+	}
+
+	*data = queue->data[head & (queue->capacity - 1)];
+
+	// Hand the slot back to the producer
+	atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+
+	return 0;
+}
+
+int
+spscqueue_enqueue_n(SPSCQueue *queue, void *const *data, int count)
+{
+	size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+	size_t room;
+	int i;
+
+	if (count <= 0) {
+		return 0;
+	}
+
+	// Only look at the consumer's index when the cached one says there is not enough room
+	room = queue->capacity - (tail - queue->head_cache);
+
+	if (room < (size_t)count) {
+		queue->head_cache = atomic_load_explicit(&queue->head, memory_order_acquire);
+		room = queue->capacity - (tail - queue->head_cache);
+	}
+
+	if ((size_t)count > room) {
+		count = (int)room;
+	}
+
+	for (i = 0; i < count; i++) {
+		queue->data[(tail + i) & (queue->capacity - 1)] = data[i];
+	}
+
+	// Publish every slot to the consumer at once
+	if (count > 0) {
+		atomic_store_explicit(&queue->tail, tail + count, memory_order_release);
+	}
+
+	return count;
+}
+
+int
+spscqueue_dequeue_n(SPSCQueue *queue, void **data, int count)
+{
+	size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+	size_t available;
+	int i;
+
+	if (count <= 0) {
+		return 0;
+	}
+
+	// Only look at the producer's index when the cached one says there is not enough data
+	available = queue->tail_cache - head;
+
+	if (available < (size_t)count) {
+		queue->tail_cache = atomic_load_explicit(&queue->tail, memory_order_acquire);
+		available = queue->tail_cache - head;
+	}
+
+	if ((size_t)count > available) {
+		count = (int)available;
+	}
+
+	for (i = 0; i < count; i++) {
+		data[i] = queue->data[(head + i) & (queue->capacity - 1)];
+	}
+
+	// Hand every slot back to the producer at once
+	if (count > 0) {
+		atomic_store_explicit(&queue->head, head + count, memory_order_release);
+	}
+
+	return count;
+}
+
+size_t
+spscqueue_size(const SPSCQueue *queue)
+{
+	// Read the head first: the tail never falls behind a head that was already read, whereas a
+	// head read after the tail may have moved past it
+	size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+	size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+	return tail - head;
+}
@@ -0,0 +1,177 @@
+/**
+ * \file spscqueue.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Definitions of a bounded lock-free single-producer/single-consumer queue
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#ifndef SPSCQUEUE_h
+#define SPSCQUEUE_h
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+/**
+ * Size of a cache line, used to keep the producer's and consumer's fields apart
+ */
+#define SPSC_QUEUE_CACHELINE 64
+
+/**
+ * \struct SPSCQueue
+ * \brief Bounded queue safe for exactly one producer thread and one consumer thread
+ *
+ * Data pointers live in a power-of-two ring. `tail` is only written by the producer and `head`
+ * only by the consumer; each side publishes its index with a release store and reads the
+ * other's with an acquire load, so no locks or read-modify-write atomics are needed. Each side
+ * also keeps a private copy of the other's index and only reloads it when the copy says the
+ * queue is full (or empty), which keeps the shared cache lines from bouncing on every operation.
+ * The producer's and consumer's fields sit on separate cache lines for the same reason.
+ */
+typedef struct SPSCQueue_s {
+	void **data;     ///< Ring of data pointers
+	size_t capacity; ///< Number of slots in `data` (a power of two)
+
+	void (*destroy)(void *data); ///< Function pointer to destroy element
+
+	_Alignas(SPSC_QUEUE_CACHELINE)
+	atomic_size_t tail; ///< Count of elements ever enqueued, written by the producer
+	size_t head_cache;  ///< Producer's last view of `head`
+
+	_Alignas(SPSC_QUEUE_CACHELINE)
+	atomic_size_t head; ///< Count of elements ever dequeued, written by the consumer
+	size_t tail_cache;  ///< Consumer's last view of `tail`
+
+} SPSCQueue;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Queue Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * \brief Function to initialize a single-producer/single-consumer queue
+ *
+ * \pre Must be called, and must return, before either thread uses the queue
+ *
+ * See *list_init* for the meaning of `destroy`.
+ *
+ * Complexity: O(1)
+ *
+ * \param queue    The queue to init
+ * \param destroy  Function pointer to free data element memory
+ * \param capacity Maximum number of elements in the queue, rounded up to a power of two
+ *
+ * \return 0 if the ring was allocated, otherwise -1
+ */
+int
+spscqueue_init(SPSCQueue *queue, void (*destroy)(void *data), size_t capacity);
+
+/**
+ * \brief Function to destroy a single-producer/single-consumer queue
+ *
+ * Calls the function passed as `destroy` to *spscqueue_init* once for each element still in the
+ * queue, provided `destroy` was not set to NULL, and frees the ring.
+ *
+ * \pre Neither thread may be using the queue
+ *
+ * Complexity: O(n), or O(1) if `destroy` is NULL
+ *
+ * \param queue The queue to destroy
+ */
+void
+spscqueue_destroy(SPSCQueue *queue);
+
+/**
+ * \brief Function to add an element to the end of the queue
+ *
+ * May only be called from the producer thread.
+ *
+ * Complexity: O(1)
+ *
+ * \param queue The queue to add element to
+ * \param data  The data to enqueue
+ *
+ * \return 0 if enqueue operation was successful, or -1 if the queue is full
+ */
+int
+spscqueue_enqueue(SPSCQueue *queue, const void *data);
+
+/**
+ * \brief Function to remove an element from the front of a queue
+ *
+ * May only be called from the consumer thread.
+ *
+ * Complexity: O(1)
+ *
+ * \param queue The queue to remove element from
+ * \param data  The dequeued data
+ *
+ * \return 0 if dequeue operation was successful, or -1 if the queue is empty
+ */
+int
+spscqueue_dequeue(SPSCQueue *queue, void **data);
+
+/**
+ * \brief Function to add several elements to the end of the queue at once
+ *
+ * Copies as many of `data[0]` to `data[count - 1]` as fit into the ring and publishes them all
+ * with a single release store. May only be called from the producer thread.
+ *
+ * Complexity: O(count)
+ *
+ * \param queue The queue to add elements to
+ * \param data  Array of `count` data to enqueue
+ * \param count Number of elements to enqueue
+ *
+ * \return Number of elements enqueued, which is less than `count` if the queue filled up
+ */
+int
+spscqueue_enqueue_n(SPSCQueue *queue, void *const *data, int count);
+
+/**
+ * \brief Function to remove several elements from the front of a queue at once
+ *
+ * Copies up to `count` elements into `data` in queue order and hands their slots back with a
+ * single release store. May only be called from the consumer thread.
+ *
+ * Complexity: O(count)
+ *
+ * \param queue The queue to remove elements from
+ * \param data  Array of room for `count` dequeued data
+ * \param count Maximum number of elements to dequeue
+ *
+ * \return Number of elements dequeued, which is 0 if the queue is empty
+ */
+int
+spscqueue_dequeue_n(SPSCQueue *queue, void **data, int count);
+
+/**
+ * \brief Function to read the number of elements in the queue
+ *
+ * Exact only when neither thread is operating on the queue; otherwise a snapshot. Safe to call
+ * from any thread.
+ *
+ * \param queue The queue to read
+ *
+ * \return The number of elements
+ */
+size_t
+spscqueue_size(const SPSCQueue *queue);
+
+/**
+ * MACRO that evaluates to the maximum number of elements in the queue
+ */
+#define spscqueue_capacity(queue) ((queue)->capacity)
+
+#ifdef __cplusplus
+}
+#endif
+#endif // SPSCQUEUE_h
@@ -24,3 +24,15 @@ stack_pop(Stack *stack, void **data)
 {
 	return list_remove_next(stack, NULL, data);
 }
+
+int
+stack_push_n(Stack *stack, void *const *data, int count)
+{
+	return list_insert_next_n(stack, NULL, data, count);
+}
+
+int
+stack_pop_n(Stack *stack, void **data, int count)
+{
+	return list_remove_next_n(stack, NULL, data, count);
+}
@@ -15,6 +15,7 @@ extern "C"
 #endif
 
 #include "list.h"
+#include "nodecache.h"
 
 // -------------------------------------------------------------------------------------------------
 // Definitions
@@ -31,6 +32,34 @@ typedef List Stack;
  */
 #define stack_init list_init
 
+/**
+ * MACRO to init the stack with a custom element allocator. Functionally same as *list_init_allocator*
+ */
+#define stack_init_allocator list_init_allocator
+
+/**
+ * MACRO to init the stack with fixed-size values stored inline. Functionally same as
+ * *list_init_inline*; *stack_pop* then copies into the buffer `*data` points to
+ */
+#define stack_init_inline list_init_inline
+
+/**
+ * MACRO to init the stack with a node pool. Functionally same as *list_init_pool*
+ */
+#define stack_init_pool list_init_pool
+
+/**
+ * MACRO to init the stack with a private element arena. Functionally same as *list_init_arena*
+ */
+#define stack_init_arena list_init_arena
+
+/**
+ * MACRO to init the stack with elements drawn from the calling thread's node cache, so that
+ * steady-state push/pop churn does not reach the global allocator (see *node_cache_allocator*)
+ */
+#define stack_init_cached(stack, destroy) \
+	list_init_allocator((stack), (destroy), &node_cache_allocator)
+
 /**
  * MACRO to destroy the stack. Functionally same as *list_destroy*
  */
@@ -67,6 +96,38 @@ stack_push(Stack *stack, const void *data);
 int
 stack_pop(Stack *stack, void **data);
 
+/**
+ * \brief Function to push several elements onto the stack at once
+ * 
+ * Arrays passed to the batch functions list the stack top first: `data[0]` ends up on top and
+ * `data[count - 1]` deepest, so *stack_pop_n* with the same count gives back the same array.
+ * The elements are spliced onto the head of the list with a single link update, and either all
+ * of them are pushed or none are.
+ * 
+ * \param stack The stack to push elements onto
+ * \param data  Array of `count` data to push, top first
+ * \param count Number of elements to push
+ * 
+ * \return 0 if stack push was successful, otherwise -1
+ */
+int
+stack_push_n(Stack *stack, void *const *data, int count);
+
+/**
+ * \brief Function to pop several elements off the stack at once
+ * 
+ * Pops up to `count` elements into `data[0]` (the former top), `data[1]`, ... unlinking them
+ * from the head of the list with a single link update.
+ * 
+ * \param stack The stack to pop the elements from
+ * \param data  Array of room for `count` popped data
+ * \param count Maximum number of elements to pop
+ * 
+ * \return Number of elements popped, which is less than `count` if the stack ran out
+ */
+int
+stack_pop_n(Stack *stack, void **data, int count);
+
 /**
  * MACRO that provides mechanism to inspect the element at top of stack
  */
@@ -0,0 +1,235 @@
+/**
+ * \file ulist.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of a generic unrolled linked-list ADT
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "ulist.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// List Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+static UList_Node *
+node_new(UList *list, UList_Node *prev)
+{
+	UList_Node *node;
+
+	if ((node = (UList_Node *)malloc(sizeof (UList_Node))) == NULL) {
+		return NULL;
+	}
+
+	node->count = 0;
+
+	// Link the node in after `prev`, or at the head
+	if (prev == NULL) {
+		node->next = list->head;
+		list->head = node;
+	} else {
+		node->next = prev->next;
+		prev->next = node;
+	}
+
+	if (node->next == NULL) {
+		list->tail = node;
+	}
+
+	return node;
+}
+
+static void
+node_put(UList_Node *node, int index, const void *data)
+{
+	// Open a slot at `index` and store the data in it
+	memmove(&node->data[index + 1], &node->data[index], sizeof (void *) * (node->count - index));
+	node->data[index] = (void *)data;
+	node->count++;
+}
+
+void
+ulist_init(UList *list, void (*destroy)(void *data))
+{
+	// Initialize the list
+	list->size = 0;
+	list->destroy = destroy;
+	list->head = NULL;
+	list->tail = NULL;
+}
+
+void
+ulist_destroy(UList *list)
+{
+	UList_Node *node;
+	int i;
+
+	// Destroy each element's data and free each node
+	while (list->head != NULL) {
+		node = list->head;
+		list->head = node->next;
+
+		if (list->destroy != NULL) {
+			for (i = 0; i < node->count; i++) {
+				list->destroy(node->data[i]);
+			}
+		}
+
+		free(node);
+	}
+
+	// No operations permitted at this point -- clear memory as precaution
+	memset(list, 0, sizeof (UList));
+}
+
+int
+ulist_insert_next(UList *list, const UList_Iter *iter, const void *data)
+{
+	UList_Node *node, *split;
+	int index, half;
+
+	if (iter == NULL) {
+		// Insert at head of the list, prepending a node if the head node is full
+
+		node = list->head;
+
+		if (node == NULL || node->count == ULIST_NODE_CAPACITY) {
+			if ((node = node_new(list, NULL)) == NULL) {
+				return -1;
+			}
+		}
+
+		index = 0;
+	} else {
+		node = iter->node;
+		index = iter->index + 1;
+
+		if (node->count == ULIST_NODE_CAPACITY) {
+			if (index == node->count) {
+				// Append past a full node -- start a new node rather than splitting
+				if ((node = node_new(list, node)) == NULL) {
+					return -1;
+				}
+
+				index = 0;
+			} else {
+				// Split the full node, moving its upper half into a new node
+				if ((split = node_new(list, node)) == NULL) {
+					return -1;
+				}
+
+				half = node->count / 2;
+				split->count = node->count - half;
+				memcpy(split->data, &node->data[half], sizeof (void *) * split->count);
+				node->count = half;
+
+				if (index > half) {
+					node = split;
+					index -= half;
+				}
+			}
+		}
+	}
+
+	node_put(node, index, data);
+
+	// Adjust the size
+	list->size++;
+
+	return 0;
+}
+
+int
+ulist_remove_next(UList *list, const UList_Iter *iter, void **data)
+{
+	UList_Node *node, *prev, *next;
+	int index;
+
+	// Check for empty list!
+	if (ulist_size(list) == 0) {
+		return -1;
+	}
+
+	// Locate the element to remove and the node before its node
+	if (iter == NULL) {
+		prev = NULL;
+		node = list->head;
+		index = 0;
+	} else if (iter->index + 1 < iter->node->count) {
+		prev = NULL;
+		node = iter->node;
+		index = iter->index + 1;
+	} else {
+		if (iter->node->next == NULL) {
+			return -1;
+		}
+
+		prev = iter->node;
+		node = iter->node->next;
+		index = 0;
+	}
+
+	*data = node->data[index];
+	node->count--;
+	memmove(&node->data[index], &node->data[index + 1], sizeof (void *) * (node->count - index));
+
+	if (node->count == 0) {
+		// Unlink the empty node
+		if (prev == NULL) {
+			list->head = node->next;
+		} else {
+			prev->next = node->next;
+		}
+
+		if (list->tail == node) {
+			list->tail = prev;
+		}
+
+		free(node);
+	} else if (node->count < ULIST_NODE_CAPACITY / 4 && (next = node->next) != NULL &&
+	           node->count + next->count <= ULIST_NODE_CAPACITY) {
+		// Merge a sparse node with its successor to keep scans dense
+		memcpy(&node->data[node->count], next->data, sizeof (void *) * next->count);
+		node->count += next->count;
+		node->next = next->next;
+
+		if (list->tail == next) {
+			list->tail = node;
+		}
+
+		free(next);
+	}
+
+	// Adjust the size of the list
+	list->size--;
+
+	return 0;
+}
+
+int
+ulist_iter_head(const UList *list, UList_Iter *iter)
+{
+	if (list->head == NULL) {
+		return -1;
+	}
+
+	iter->node = list->head;
+	iter->index = 0;
+
+	return 0;
+}
+
+int
+ulist_iter_tail(const UList *list, UList_Iter *iter)
+{
+	if (list->tail == NULL) {
+		return -1;
+	}
+
+	iter->node = list->tail;
+	iter->index = list->tail->count - 1;
+
+	return 0;
+}
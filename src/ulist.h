@@ -0,0 +1,198 @@
+/**
+ * \file ulist.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Definitions of a generic unrolled linked-list ADT
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#ifndef ULIST_h
+#define ULIST_h
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+/**
+ * Number of data pointers held by each node; chosen so a node fills two 64-byte cache lines
+ */
+#define ULIST_NODE_CAPACITY 14
+
+/**
+ * \struct UList_Node
+ * \brief Unrolled linked-list node holding up to ULIST_NODE_CAPACITY data pointers
+ */
+typedef struct UList_Node_s {
+	struct UList_Node_s *next;        ///< Pointer to next node in list
+	int count;                        ///< Number of data pointers in use
+
+	void *data[ULIST_NODE_CAPACITY];  ///< Data pointers, packed at the front
+
+} UList_Node;
+
+/**
+ * \struct UList
+ * \brief Generic unrolled linked-list
+ *
+ * Behaves like *List*, but stores several consecutive data pointers per node, so a sequential
+ * scan touches roughly one cache line per seven elements instead of one per element, and each
+ * allocation is amortized over a whole node.
+ */
+typedef struct UList_s {
+	int size; ///< Number of elements in list
+
+	void (*destroy)(void *data); ///< Function pointer to destroy element
+
+	UList_Node *head; ///< Pointer to first node in list
+	UList_Node *tail; ///< Pointer to last node in list
+
+} UList;
+
+/**
+ * \struct UList_Iter
+ * \brief Position of an element in an unrolled linked-list
+ *
+ * Elements move between slots as the list changes, so an iterator plays the role a
+ * List_Element pointer plays for *List*. Any insert or remove invalidates every iterator on the
+ * list, including the one passed to that operation.
+ */
+typedef struct UList_Iter_s {
+	UList_Node *node; ///< Node holding the element
+	int index;        ///< Slot of the element within the node
+
+} UList_Iter;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// List Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * \brief Function to initialize an unrolled linked-list
+ * 
+ * \pre Must be called before the list can be used by any other operation
+ * 
+ * The `destroy` argument provides a way to free dynamically allocated data when
+ * *ulist_destroy* is called, exactly as for *list_init*.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list    The unrolled linked-list to init
+ * \param destroy Function pointer to free data element memory
+ */
+void
+ulist_init(UList *list, void (*destroy)(void *data));
+
+/**
+ * \brief Function to destroy an unrolled linked-list
+ * 
+ * Removes all elements, calling `destroy` once for each element's data provided it was not set
+ * to NULL, and frees every node.
+ * 
+ * \note
+ * No operation is permitted after *ulist_destroy* is called unless *ulist_init* is called again.
+ * 
+ * Complexity: O(n)
+ * 
+ * \param list The unrolled linked-list to destroy
+ */
+void
+ulist_destroy(UList *list);
+
+/**
+ * \brief Function to insert an element into an unrolled linked-list
+ * 
+ * Inserts an element just after the one at `iter`. If `iter` is NULL, the new element is
+ * inserted at the head of the list. A full node is split in two, except when appending past its
+ * last element (or prepending before the head), where a fresh node is linked in instead so that
+ * queue and stack usage keeps nodes densely packed.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list The unrolled linked-list to insert element into
+ * \param iter Position of element to insert after, or NULL for the head
+ * \param data The data to insert
+ * 
+ * \return 0 if inserting into list was successful, otherwise -1
+ */
+int
+ulist_insert_next(UList *list, const UList_Iter *iter, const void *data);
+
+/**
+ * \brief Function to remove an element from an unrolled linked-list
+ * 
+ * Removes the element just past the one at `iter`. If `iter` is NULL, the element at the head
+ * of the list is removed. Upon return `data` points to the data stored in the element that was
+ * removed. A node left less than a quarter full is merged with its successor when they fit in
+ * one node, and an empty node is freed.
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list The unrolled linked-list to remove element from
+ * \param iter Position of element to remove after, or NULL for the head
+ * \param data The data removed
+ * 
+ * \return 0 if removing from list was successful, otherwise -1
+ */
+int
+ulist_remove_next(UList *list, const UList_Iter *iter, void **data);
+
+/**
+ * \brief Function to position an iterator at the head of an unrolled linked-list
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list The unrolled linked-list
+ * \param iter Upon return, the position of the first element
+ * 
+ * \return 0 if the list is not empty, otherwise -1
+ */
+int
+ulist_iter_head(const UList *list, UList_Iter *iter);
+
+/**
+ * \brief Function to position an iterator at the tail of an unrolled linked-list
+ * 
+ * Complexity: O(1)
+ * 
+ * \param list The unrolled linked-list
+ * \param iter Upon return, the position of the last element
+ * 
+ * \return 0 if the list is not empty, otherwise -1
+ */
+int
+ulist_iter_tail(const UList *list, UList_Iter *iter);
+
+/**
+ * MACRO that evaluates to the number of elements in the unrolled linked-list
+ */
+#define ulist_size(list) ((list)->size)
+
+/**
+ * MACRO that evaluates to the data stored at the position of an iterator
+ */
+#define ulist_data(iter) ((iter)->node->data[(iter)->index])
+
+/**
+ * MACRO that determines whether an iterator is positioned at the tail of the list
+ */
+#define ulist_is_tail(iter) \
+	((iter)->node->next == NULL && (iter)->index == (iter)->node->count - 1 ? 1 : 0)
+
+/**
+ * MACRO that advances an iterator to the next element. Evaluates to 0 on success, or -1 (leaving
+ * the iterator unusable) when it was already at the tail
+ */
+#define ulist_iter_next(iter) \
+	(++(iter)->index < (iter)->node->count ? 0 : \
+	 ((iter)->index = 0, ((iter)->node = (iter)->node->next) == NULL ? -1 : 0))
+
+#ifdef __cplusplus
+}
+#endif
+#endif // ULIST_h
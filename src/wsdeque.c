@@ -0,0 +1,207 @@
+/**
+ * \file wsdeque.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of a lock-free work-stealing deque
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "wsdeque.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Deque Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+static WSDeque_Array *
+array_new(size_t capacity)
+{
+	WSDeque_Array *array;
+
+	if (capacity > ((size_t)-1 - sizeof (WSDeque_Array)) / sizeof (void *)) {
+		return NULL;
+	}
+
+	if ((array = (WSDeque_Array *)malloc(sizeof (WSDeque_Array) +
+	                                     capacity * sizeof (void *))) == NULL) {
+		return NULL;
+	}
+
+	array->capacity = capacity;
+	array->previous = NULL;
+
+	return array;
+}
+
+#define slot(array, position) (&(array)->data[(size_t)(position) & ((array)->capacity - 1)])
+
+// Copy the live positions into a ring twice the size; only the owner calls this
+static WSDeque_Array *
+array_grow(WSDeque *deque, WSDeque_Array *array, long top, long bottom)
+{
+	WSDeque_Array *bigger;
+	long i;
+
+	if (array->capacity > (size_t)-1 / 2 || (bigger = array_new(array->capacity * 2)) == NULL) {
+		return NULL;
+	}
+
+	for (i = top; i < bottom; i++) {
+		atomic_store_explicit(slot(bigger, i), atomic_load_explicit(slot(array, i),
+		                      memory_order_relaxed), memory_order_relaxed);
+	}
+
+	// Thieves may still be reading the old ring, so it is only freed by destroy
+	bigger->previous = array;
+	atomic_store_explicit(&deque->array, bigger, memory_order_release);
+
+	return bigger;
+}
+
+int
+wsdeque_init(WSDeque *deque, void (*destroy)(void *data), size_t capacity)
+{
+	WSDeque_Array *array;
+	size_t rounded = 1;
+
+	if (capacity == 0) {
+		capacity = WS_DEQUE_DEFAULT_CAPACITY;
+	}
+
+	while (rounded < capacity) {
+		if (rounded > (size_t)-1 / 2) {
+			return -1;
+		}
+
+		rounded *= 2;
+	}
+
+	if ((array = array_new(rounded)) == NULL) {
+		return -1;
+	}
+
+	// Initialize the deque
+	atomic_init(&deque->top, 0);
+	atomic_init(&deque->bottom, 0);
+	atomic_init(&deque->array, array);
+	deque->destroy = destroy;
+
+	return 0;
+}
+
+void
+wsdeque_destroy(WSDeque *deque)
+{
+	WSDeque_Array *array, *previous;
+	void *data;
+
+	// Destroy the data of each element, oldest first
+	if (deque->destroy != NULL) {
+		while (wsdeque_steal(deque, &data) == 0) {
+			deque->destroy(data);
+		}
+	}
+
+	// Free the current ring and every ring it replaced
+	array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+
+	while (array != NULL) {
+		previous = array->previous;
+		free(array);
+		array = previous;
+	}
+
+	// No operations permitted at this point -- clear memory as precaution
+	memset(deque, 0, sizeof (WSDeque));
+}
+
+int
+wsdeque_push(WSDeque *deque, const void *data)
+{
+	long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+	long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+	WSDeque_Array *array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+
+	if ((size_t)(bottom - top) >= array->capacity) {
+		if ((array = array_grow(deque, array, top, bottom)) == NULL) {
+			return -1;
+		}
+	}
+
+	atomic_store_explicit(slot(array, bottom), (void *)data, memory_order_relaxed);
+
+	// Publish the slot before the thieves can see the new bottom
+	atomic_thread_fence(memory_order_release);
+	atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+
+	return 0;
+}
+
+int
+wsdeque_pop(WSDeque *deque, void **data)
+{
+	long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+	WSDeque_Array *array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+	void *popped;
+	long top;
+	int won;
+
+	// Reserve the bottom element first, then see whether a thief is after it too
+	atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+	atomic_thread_fence(memory_order_seq_cst);
+	top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+	if (top > bottom) {
+		// Empty -- undo the reservation
+		atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+		return -1;
+	}
+
+	popped = atomic_load_explicit(slot(array, bottom), memory_order_relaxed);
+
+	if (top == bottom) {
+		// Last element -- race the thieves for it through `top`, then put `bottom` back either way
+		won = atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+		                                              memory_order_seq_cst, memory_order_relaxed);
+
+		atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+
+		if (!won) {
+			return -1;
+		}
+	}
+
+	*data = popped;
+
+	return 0;
+}
+
+int
+wsdeque_steal(WSDeque *deque, void **data)
+{
+	long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+	WSDeque_Array *array;
+	long bottom;
+	void *stolen;
+
+	atomic_thread_fence(memory_order_seq_cst);
+	bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+
+	if (top >= bottom) {
+		return -1;
+	}
+
+	// Read the element before claiming it; the owner may reuse the slot once `top` moves on
+	array = atomic_load_explicit(&deque->array, memory_order_acquire);
+	stolen = atomic_load_explicit(slot(array, top), memory_order_relaxed);
+
+	if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+	                                             memory_order_seq_cst, memory_order_relaxed)) {
+		return -1;
+	}
+
+	*data = stolen;
+
+	return 0;
+}
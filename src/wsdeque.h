@@ -0,0 +1,175 @@
+/**
+ * \file wsdeque.h
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Definitions of a lock-free work-stealing deque
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#ifndef WSDEQUE_h
+#define WSDEQUE_h
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+// -------------------------------------------------------------------------------------------------
+// Definitions
+// -------------------------------------------------------------------------------------------------
+
+/**
+ * Size of a cache line, used to keep the owner's and thieves' indices apart
+ */
+#define WS_DEQUE_CACHELINE 64
+
+/**
+ * Default number of slots when *wsdeque_init* is given a capacity of 0
+ */
+#define WS_DEQUE_DEFAULT_CAPACITY 64
+
+/**
+ * \struct WSDeque_Array
+ * \brief Ring of data pointers backing a work-stealing deque
+ */
+typedef struct WSDeque_Array_s {
+	size_t capacity;                  ///< Number of slots in `data` (a power of two)
+	struct WSDeque_Array_s *previous; ///< Array this one replaced, kept until destroy
+
+	_Atomic(void *) data[];           ///< Slots, indexed by position modulo `capacity`
+
+} WSDeque_Array;
+
+/**
+ * \struct WSDeque
+ * \brief Chase-Lev work-stealing deque
+ *
+ * One thread, the owner, pushes and pops at the bottom without locks or read-modify-write atomics
+ * except when taking the last element. Any number of other threads, thieves, steal from the top
+ * with a compare-and-swap on `top`. The owner therefore works in LIFO order on its own most recent
+ * tasks while thieves take the oldest, and largest, ones.
+ *
+ * When the ring fills up the owner copies it into one twice the size. Thieves may still be reading
+ * the old ring, so replaced rings are chained on `previous` and only freed by *wsdeque_destroy*.
+ */
+typedef struct WSDeque_s {
+	_Alignas(WS_DEQUE_CACHELINE)
+	atomic_long top;    ///< Position of the oldest element, advanced by thieves (and the owner)
+
+	_Alignas(WS_DEQUE_CACHELINE)
+	atomic_long bottom; ///< Position after the newest element, written by the owner
+	_Atomic(WSDeque_Array *) array; ///< Current ring, replaced by the owner when it grows
+
+	void (*destroy)(void *data); ///< Function pointer to destroy element
+
+} WSDeque;
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Deque Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+/**
+ * \brief Function to initialize a work-stealing deque
+ *
+ * \pre Must be called, and must return, before any thread uses the deque
+ *
+ * See *list_init* for the meaning of `destroy`.
+ *
+ * Complexity: O(1)
+ *
+ * \param deque    The deque to init
+ * \param destroy  Function pointer to free data element memory
+ * \param capacity Initial number of slots rounded up to a power of two, or 0 for
+ *                 WS_DEQUE_DEFAULT_CAPACITY
+ *
+ * \return 0 if the ring was allocated, otherwise -1
+ */
+int
+wsdeque_init(WSDeque *deque, void (*destroy)(void *data), size_t capacity);
+
+/**
+ * \brief Function to destroy a work-stealing deque
+ *
+ * Calls the function passed as `destroy` to *wsdeque_init* once for each element still in the
+ * deque, provided `destroy` was not set to NULL, and frees the current ring and every ring it
+ * replaced.
+ *
+ * \pre No thread may be using the deque
+ *
+ * Complexity: O(n)
+ *
+ * \param deque The deque to destroy
+ */
+void
+wsdeque_destroy(WSDeque *deque);
+
+/**
+ * \brief Function to push an element onto the bottom of the deque
+ *
+ * May only be called from the owner thread. Grows the ring if it is full.
+ *
+ * Complexity: O(1) amortized
+ *
+ * \param deque The deque to push element onto
+ * \param data  The data to push
+ *
+ * \return 0 if push operation was successful, or -1 if a larger ring could not be allocated
+ */
+int
+wsdeque_push(WSDeque *deque, const void *data);
+
+/**
+ * \brief Function to pop the newest element from the bottom of the deque
+ *
+ * May only be called from the owner thread.
+ *
+ * Complexity: O(1)
+ *
+ * \param deque The deque to pop element from
+ * \param data  The popped data
+ *
+ * \return 0 if pop operation was successful, or -1 if the deque is empty (or a thief took its
+ *         last element first)
+ */
+int
+wsdeque_pop(WSDeque *deque, void **data);
+
+/**
+ * \brief Function to steal the oldest element from the top of the deque
+ *
+ * May be called from any thread, including the owner.
+ *
+ * Complexity: O(1), lock-free
+ *
+ * \param deque The deque to steal element from
+ * \param data  The stolen data
+ *
+ * \return 0 if steal operation was successful, or -1 if the deque is empty or another thread
+ *         took the element first; in the latter case the caller may simply try again
+ */
+int
+wsdeque_steal(WSDeque *deque, void **data);
+
+/**
+ * MACRO that evaluates to the number of elements in the deque
+ *
+ * Exact only when no thread is operating on the deque; otherwise a snapshot.
+ */
+#define wsdeque_size(deque) \
+	(atomic_load_explicit(&(deque)->bottom, memory_order_acquire) - \
+	 atomic_load_explicit(&(deque)->top, memory_order_acquire))
+
+/**
+ * MACRO that evaluates to the number of slots in the current ring
+ *
+ * Only meaningful on the owner thread.
+ */
+#define wsdeque_capacity(deque) \
+	(atomic_load_explicit(&(deque)->array, memory_order_relaxed)->capacity)
+
+#ifdef __cplusplus
+}
+#endif
+#endif // WSDEQUE_h
@@ -0,0 +1,270 @@
+/**
+ * \file xlist.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Implementation of a generic XOR-linked doubly linked-list ADT
+ * \version 0.1
+ * \date 2026-10-17
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "xlist.h"
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// List Functions
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+static XList_Element *
+element_new(XList *list, const void *data)
+{
+	XList_Element *element;
+
+	if ((element = (XList_Element *)allocator_alloc(&list->allocator,
+	                                                sizeof (XList_Element))) == NULL) {
+		return NULL;
+	}
+
+	element->data = (void *)data;
+
+	return element;
+}
+
+static int
+insert_first(XList *list, const void *data)
+{
+	XList_Element *element;
+
+	if ((element = element_new(list, data)) == NULL) {
+		return -1;
+	}
+
+	// A lone element has no neighbours on either side
+	element->link = 0;
+	list->head = element;
+	list->tail = element;
+	list->size++;
+
+	return 0;
+}
+
+void
+xlist_init(XList *list, void (*destroy)(void *data))
+{
+	// Initialize the list
+	list->size = 0;
+	list->destroy = destroy;
+	list->head = NULL;
+	list->tail = NULL;
+	list->allocator = allocator_default;
+}
+
+void
+xlist_init_allocator(XList *list, void (*destroy)(void *data), const Allocator *allocator)
+{
+	// Initialize the list, then attach the allocator
+	xlist_init(list, destroy);
+	list->allocator = *allocator;
+}
+
+int
+xlist_init_arena(XList *list, void (*destroy)(void *data), size_t slab_count)
+{
+	Allocator allocator;
+
+	if (pool_arena_allocator(&allocator, sizeof (XList_Element), slab_count, 0) != 0) {
+		return -1;
+	}
+
+	xlist_init_allocator(list, destroy, &allocator);
+
+	return 0;
+}
+
+void
+xlist_destroy(XList *list)
+{
+	XList_Cursor cursor;
+	void *data;
+
+	// Remove each element in list, walking forward from the head
+	if (list->allocator.release != NULL) {
+		if (list->destroy != NULL && xlist_cursor_head(list, &cursor) == 0) {
+			do {
+				list->destroy(xlist_data(&cursor));
+			} while (xlist_next(&cursor) == 0);
+		}
+
+		list->allocator.release(list->allocator.context);
+	} else if (xlist_cursor_head(list, &cursor) == 0) {
+		while (cursor.curr != NULL) {
+			if (xlist_remove(list, &cursor, &data) == 0 && list->destroy != NULL) {
+				list->destroy(data);
+			}
+		}
+	}
+
+	// No operations permitted at this point -- clear memory as precaution
+	memset(list, 0, sizeof (XList));
+}
+
+int
+xlist_insert_next(XList *list, XList_Cursor *cursor, const void *data)
+{
+	XList_Element *new_element, *next;
+
+	// Do not allow a NULL cursor unless the list is empty
+	if (cursor == NULL) {
+		return xlist_size(list) == 0 ? insert_first(list, data) : -1;
+	}
+
+	if (cursor->curr == NULL || (new_element = element_new(list, data)) == NULL) {
+		return -1;
+	}
+
+	// Splice the new element in between curr and next
+	next = xlist_other(cursor->curr, cursor->prev);
+
+	new_element->link = (uintptr_t)cursor->curr ^ (uintptr_t)next;
+	cursor->curr->link = (uintptr_t)cursor->prev ^ (uintptr_t)new_element;
+
+	if (next == NULL) {
+		list->tail = new_element;
+	} else {
+		next->link ^= (uintptr_t)cursor->curr ^ (uintptr_t)new_element;
+	}
+
+	// Adjust the size
+	list->size++;
+
+	return 0;
+}
+
+int
+xlist_insert_prev(XList *list, XList_Cursor *cursor, const void *data)
+{
+	XList_Element *new_element, *next;
+
+	// Do not allow a NULL cursor unless the list is empty
+	if (cursor == NULL) {
+		return xlist_size(list) == 0 ? insert_first(list, data) : -1;
+	}
+
+	if (cursor->curr == NULL || (new_element = element_new(list, data)) == NULL) {
+		return -1;
+	}
+
+	// Splice the new element in between prev and curr
+	next = xlist_other(cursor->curr, cursor->prev);
+
+	new_element->link = (uintptr_t)cursor->prev ^ (uintptr_t)cursor->curr;
+	cursor->curr->link = (uintptr_t)new_element ^ (uintptr_t)next;
+
+	if (cursor->prev == NULL) {
+		list->head = new_element;
+	} else {
+		cursor->prev->link ^= (uintptr_t)cursor->curr ^ (uintptr_t)new_element;
+	}
+
+	cursor->prev = new_element;
+
+	// Adjust the size
+	list->size++;
+
+	return 0;
+}
+
+int
+xlist_remove(XList *list, XList_Cursor *cursor, void **data)
+{
+	XList_Element *old_element, *next;
+
+	// Do not allow a NULL element or removal from empty list
+	if (cursor == NULL || cursor->curr == NULL || xlist_size(list) == 0) {
+		return -1;
+	}
+
+	old_element = cursor->curr;
+	next = xlist_other(old_element, cursor->prev);
+
+	*data = old_element->data;
+
+	// Link prev and next to each other in place of the old element
+	if (cursor->prev == NULL) {
+		list->head = next;
+	} else {
+		cursor->prev->link ^= (uintptr_t)old_element ^ (uintptr_t)next;
+	}
+
+	if (next == NULL) {
+		list->tail = cursor->prev;
+	} else {
+		next->link ^= (uintptr_t)old_element ^ (uintptr_t)cursor->prev;
+	}
+
+	cursor->curr = next;
+
+	// Free storage allocated by the abstract datatype
+	allocator_free(&list->allocator, old_element, sizeof (XList_Element));
+
+	// Adjust the size of the list
+	list->size--;
+
+	return 0;
+}
+
+int
+xlist_cursor_head(const XList *list, XList_Cursor *cursor)
+{
+	if (list->head == NULL) {
+		return -1;
+	}
+
+	cursor->prev = NULL;
+	cursor->curr = list->head;
+
+	return 0;
+}
+
+int
+xlist_cursor_tail(const XList *list, XList_Cursor *cursor)
+{
+	if (list->tail == NULL) {
+		return -1;
+	}
+
+	// The tail has no next, so its link is its prev
+	cursor->prev = (XList_Element *)list->tail->link;
+	cursor->curr = list->tail;
+
+	return 0;
+}
+
+int
+xlist_next(XList_Cursor *cursor)
+{
+	XList_Element *next;
+
+	if (cursor->curr == NULL || (next = xlist_other(cursor->curr, cursor->prev)) == NULL) {
+		return -1;
+	}
+
+	cursor->prev = cursor->curr;
+	cursor->curr = next;
+
+	return 0;
+}
+
+int
+xlist_prev(XList_Cursor *cursor)
+{
+	XList_Element *prev = cursor->prev;
+
+	if (cursor->curr == NULL || prev == NULL) {
+		return -1;
+	}
+
+	cursor->prev = xlist_other(prev, cursor->curr);
+	cursor->curr = prev;
+
+	return 0;
+}
@@ -0,0 +1,160 @@
+/**
+ * \file adlist_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for array-backed doubly linked-list ADT
+ */
+#include <criterion/criterion.h>
+
+#include <stdlib.h> // malloc(), free()
+#include <string.h> // memcpy()
+
+#include "../src/adlist.h"
+
+ADList list;
+
+int items[5] = { 0, 1, 2, 3, 4 };
+
+void
+suite_setup()
+{
+	adlist_init(&list, NULL);
+}
+
+void
+suite_teardown()
+{
+	adlist_destroy(&list);
+}
+
+TestSuite(adlist_tests, .init=suite_setup, .fini=suite_teardown);
+
+// Checks the list holds `expected` both walking forward from the head and back from the tail
+static void
+expect_contents(const ADList *list, const int *expected, int count)
+{
+	uint32_t element;
+	int i;
+
+	cr_expect(adlist_size(list) == count, "list's size should be %d", count);
+
+	for (i = 0, element = adlist_head(list); element != ADLIST_NIL; element = adlist_next(list, element)) {
+		cr_assert(i < count, "list should not be longer than its size");
+		cr_expect(*(int *)adlist_data(list, element) == expected[i], "forward element %d should be %d", i, expected[i]);
+		i++;
+	}
+
+	cr_expect(i == count, "forward walk should visit %d elements", count);
+
+	for (i = count, element = adlist_tail(list); element != ADLIST_NIL; element = adlist_prev(list, element)) {
+		i--;
+		cr_assert(i >= 0, "list should not be longer than its size");
+		cr_expect(*(int *)adlist_data(list, element) == expected[i], "backward element %d should be %d", i, expected[i]);
+	}
+
+	cr_expect(i == 0, "backward walk should visit %d elements", count);
+}
+
+Test(adlist_tests, empty)
+{
+	void *removed;
+
+	cr_expect(adlist_size(&list) == 0, "empty list's size should be 0");
+	cr_expect(adlist_head(&list) == ADLIST_NIL, "empty list's head should be ADLIST_NIL");
+	cr_expect(adlist_tail(&list) == ADLIST_NIL, "empty list's tail should be ADLIST_NIL");
+	cr_expect(adlist_remove(&list, ADLIST_NIL, &removed) == -1, "remove from empty list should return -1");
+}
+
+Test(adlist_tests, insert)
+{
+	int expected[5] = { 0, 1, 2, 3, 4 };
+	uint32_t element;
+
+	cr_expect(adlist_insert_next(&list, ADLIST_NIL, &items[2]) == 0, "insert into empty list should return 0");
+	cr_expect(adlist_insert_next(&list, ADLIST_NIL, &items[3]) == -1, "ADLIST_NIL into non-empty list should return -1");
+
+	element = adlist_head(&list);
+	cr_expect(adlist_insert_prev(&list, element, &items[0]) == 0, "insert before head should return 0");
+	cr_expect(adlist_insert_prev(&list, element, &items[1]) == 0, "insert before element should return 0");
+	cr_expect(adlist_is_head(&list, adlist_head(&list)) == 1, "head should have no prev");
+
+	element = adlist_tail(&list);
+	cr_expect(adlist_insert_next(&list, element, &items[4]) == 0, "insert after tail should return 0");
+	cr_expect(adlist_insert_next(&list, element, &items[3]) == 0, "insert after element should return 0");
+	cr_expect(adlist_is_tail(&list, adlist_tail(&list)) == 1, "tail should have no next");
+
+	expect_contents(&list, expected, 5);
+}
+
+Test(adlist_tests, remove_recycles)
+{
+	int expected[4] = { 0, 1, 3, 4 };
+	uint32_t element, middle;
+	void *removed;
+	int i;
+
+	adlist_insert_next(&list, ADLIST_NIL, &items[0]);
+
+	for (i = 1; i < 5; i++) {
+		adlist_insert_next(&list, adlist_tail(&list), &items[i]);
+	}
+
+	middle = adlist_next(&list, adlist_next(&list, adlist_head(&list)));
+
+	cr_expect(adlist_remove(&list, middle, &removed) == 0, "remove in between should return 0");
+	cr_expect(removed == &items[2], "removed item should be the middle one");
+	cr_expect(list.free_list == middle, "removed slot should be on the free chain");
+
+	expect_contents(&list, expected, 4);
+
+	// The freed slot is handed out again before any untouched one
+	cr_expect(adlist_insert_prev(&list, adlist_head(&list), &items[2]) == 0, "insert at head should return 0");
+	cr_expect(adlist_head(&list) == middle, "recycled slot should become the head");
+	cr_expect(list.used == 5, "no new slot should have been used");
+
+	// Remove the tail, then the head
+	element = adlist_tail(&list);
+	cr_expect(adlist_remove(&list, element, &removed) == 0 && removed == &items[4], "remove at tail should return 0");
+	element = adlist_head(&list);
+	cr_expect(adlist_remove(&list, element, &removed) == 0 && removed == &items[2], "remove at head should return 0");
+
+	expect_contents(&list, expected, 3);
+}
+
+Test(adlist_tests, grow_and_relocate)
+{
+	ADList copy;
+	long i, n = 3 * ADLIST_DEFAULT_CAPACITY;
+	uint32_t element;
+
+	adlist_insert_next(&list, ADLIST_NIL, (void *)0);
+
+	for (i = 1; i < n; i++) {
+		cr_expect(adlist_insert_next(&list, adlist_tail(&list), (void *)i) == 0, "insert should return 0");
+	}
+
+	cr_expect(list.capacity >= (uint32_t)n, "array should have grown to hold every element");
+
+	// Links are indices, so a byte copy of the array is a working list
+	copy = list;
+	copy.elements = (ADList_Element *)malloc(list.capacity * sizeof (ADList_Element));
+	memcpy(copy.elements, list.elements, list.capacity * sizeof (ADList_Element));
+
+	for (i = 0, element = adlist_head(&copy); element != ADLIST_NIL; element = adlist_next(&copy, element)) {
+		cr_expect(adlist_data(&copy, element) == (void *)i, "copied element %ld should be intact", i);
+		i++;
+	}
+
+	cr_expect(i == n, "copied list should hold every element");
+
+	adlist_destroy(&copy);
+}
+
+Test(adlist_tests, reserve)
+{
+	cr_expect(adlist_reserve(&list, 100) == 0, "reserve should return 0");
+	cr_expect(list.capacity == 100, "capacity should be 100");
+	cr_expect(adlist_reserve(&list, 10) == 0, "smaller reserve should return 0");
+	cr_expect(list.capacity == 100, "reserve should not shrink the array");
+	cr_expect(adlist_reserve(&list, ADLIST_NIL) == -1, "reserving ADLIST_NIL slots should return -1");
+	cr_expect(adlist_reserve(&list, ADLIST_MAX_CAPACITY + 1) == -1, "reserving past ADLIST_MAX_CAPACITY should return -1");
+}
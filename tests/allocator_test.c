@@ -0,0 +1,154 @@
+/**
+ * \file allocator_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for custom element allocators on List, DList and CList
+ */
+#include <criterion/criterion.h>
+
+#include <stdlib.h>
+
+#include "../src/allocator.h"
+#include "../src/clist.h"
+#include "../src/dlist.h"
+#include "../src/list.h"
+
+typedef struct Counter_s {
+	int allocs;
+	int frees;
+	int releases;
+	size_t bytes; // Outstanding bytes
+
+} Counter;
+
+Counter counter;
+Allocator allocator;
+
+static void *
+counting_alloc(void *context, size_t size)
+{
+	Counter *c = (Counter *)context;
+
+	c->allocs++;
+	c->bytes += size;
+
+	return malloc(size);
+}
+
+static void
+counting_free(void *context, void *ptr, size_t size)
+{
+	Counter *c = (Counter *)context;
+
+	c->frees++;
+	c->bytes -= size;
+
+	free(ptr);
+}
+
+static void
+counting_release(void *context)
+{
+	((Counter *)context)->releases++;
+}
+
+void
+suite_setup()
+{
+	counter.allocs = 0;
+	counter.frees = 0;
+	counter.releases = 0;
+	counter.bytes = 0;
+
+	allocator.alloc = counting_alloc;
+	allocator.free = counting_free;
+	allocator.release = NULL;
+	allocator.context = &counter;
+}
+
+TestSuite(allocator_tests, .init=suite_setup);
+
+Test(allocator_tests, default_allocator)
+{
+	List list;
+
+	list_init(&list, NULL);
+	cr_expect(list.allocator.alloc == allocator_default.alloc, "list_init should use the default allocator");
+	cr_expect(list.allocator.free == allocator_default.free, "list_init should use the default allocator");
+	list_destroy(&list);
+}
+
+Test(allocator_tests, list_allocator)
+{
+	List list;
+	int item = 1;
+	void *removed;
+
+	list_init_allocator(&list, NULL, &allocator);
+
+	cr_expect(list_insert_next(&list, NULL, &item) == 0, "insert into empty list should return 0");
+	cr_expect(list_insert_next(&list, NULL, &item) == 0, "insert at head should return 0");
+	cr_expect(counter.allocs == 2, "each insert should allocate through the allocator");
+	cr_expect(counter.bytes == 2 * sizeof (List_Element), "allocations should be element sized");
+
+	cr_expect(list_remove_next(&list, NULL, &removed) == 0, "remove at head should return 0");
+	cr_expect(counter.frees == 1, "remove should free through the allocator");
+
+	list_destroy(&list);
+	cr_expect(counter.frees == 2, "destroy should free through the allocator");
+	cr_expect(counter.bytes == 0, "every allocation should be released");
+	cr_expect(counter.releases == 0, "destroy should not release an allocator without release");
+}
+
+Test(allocator_tests, list_release)
+{
+	List list;
+	int item = 1;
+
+	allocator.alloc = counting_alloc;
+	allocator.free = counting_free;
+	allocator.release = counting_release;
+
+	list_init_allocator(&list, NULL, &allocator);
+
+	cr_expect(list_insert_next(&list, NULL, &item) == 0, "insert into empty list should return 0");
+	cr_expect(list_insert_next(&list, NULL, &item) == 0, "insert at head should return 0");
+
+	list_destroy(&list);
+	cr_expect(counter.frees == 0, "destroy should not free elements one by one");
+	cr_expect(counter.releases == 1, "destroy should release the allocator once");
+}
+
+Test(allocator_tests, dlist_allocator)
+{
+	DList list;
+	int item = 1;
+
+	dlist_init_allocator(&list, NULL, &allocator);
+
+	cr_expect(dlist_insert_next(&list, NULL, &item) == 0, "insert into empty list should return 0");
+	cr_expect(dlist_insert_prev(&list, dlist_head(&list), &item) == 0, "insert before head should return 0");
+	cr_expect(dlist_insert_next(&list, dlist_tail(&list), &item) == 0, "insert after tail should return 0");
+	cr_expect(counter.allocs == 3, "each insert should allocate through the allocator");
+	cr_expect(counter.bytes == 3 * sizeof (DList_Element), "allocations should be element sized");
+
+	dlist_destroy(&list);
+	cr_expect(counter.frees == 3, "destroy should free through the allocator");
+	cr_expect(counter.bytes == 0, "every allocation should be released");
+}
+
+Test(allocator_tests, clist_allocator)
+{
+	CList list;
+	int item = 1;
+
+	clist_init_allocator(&list, NULL, &allocator);
+
+	cr_expect(clist_insert_next(&list, NULL, &item) == 0, "insert into empty list should return 0");
+	cr_expect(clist_insert_next(&list, clist_head(&list), &item) == 0, "insert after head should return 0");
+	cr_expect(counter.allocs == 2, "each insert should allocate through the allocator");
+	cr_expect(counter.bytes == 2 * sizeof (CList_Element), "allocations should be element sized");
+
+	clist_destroy(&list);
+	cr_expect(counter.frees == 2, "destroy should free through the allocator");
+	cr_expect(counter.bytes == 0, "every allocation should be released");
+}
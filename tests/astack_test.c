@@ -0,0 +1,150 @@
+/**
+ * \file astack_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for array-backed Stack ADT
+ */
+#include <criterion/criterion.h>
+
+#include <stdlib.h> // free()
+
+#include "../src/astack.h"
+
+AStack stack;
+
+int items[3] = { 1, 2, 3 };
+
+void
+suite_setup()
+{
+	astack_init(&stack, NULL);
+}
+
+void
+suite_teardown()
+{
+	astack_destroy(&stack);
+}
+
+TestSuite(astack_tests, .init=suite_setup, .fini=suite_teardown);
+
+Test(astack_tests, empty)
+{
+	void *popped;
+
+	cr_expect(astack_size(&stack) == 0, "empty stack's size should be 0");
+	cr_expect(astack_peek(&stack) == NULL, "empty stack's peek should be NULL");
+	cr_expect(astack_pop(&stack, &popped) == -1, "pop from empty stack should return -1");
+}
+
+Test(astack_tests, push_peek_pop)
+{
+	void *popped;
+	int i;
+
+	for (i = 0; i < 3; i++) {
+		cr_expect(astack_push(&stack, &items[i]) == 0, "push should return 0");
+		cr_expect(astack_size(&stack) == i + 1, "stack's size should be %d", i + 1);
+		cr_expect(astack_peek(&stack) == &items[i], "top of stack should be last item pushed");
+	}
+
+	for (i = 2; i >= 0; i--) {
+		cr_expect(astack_pop(&stack, &popped) == 0, "pop should return 0");
+		cr_expect(popped == &items[i], "pop should return items in reverse order");
+	}
+
+	cr_expect(astack_size(&stack) == 0, "stack should be empty again");
+}
+
+Test(astack_tests, grow)
+{
+	void *popped;
+	long i, n = 10 * ASTACK_DEFAULT_CAPACITY;
+
+	for (i = 0; i < n; i++) {
+		cr_expect(astack_push(&stack, (void *)i) == 0, "push should return 0");
+	}
+
+	cr_expect(astack_capacity(&stack) >= (size_t)n, "array should have grown");
+
+	for (i = n - 1; i >= 0; i--) {
+		cr_expect(astack_pop(&stack, &popped) == 0 && popped == (void *)i, "pop should return %ld", i);
+	}
+
+	cr_expect(astack_capacity(&stack) >= (size_t)n, "array should not shrink unless enabled");
+}
+
+Test(astack_tests, shrink_hysteresis)
+{
+	void *popped;
+	size_t capacity;
+	long i;
+
+	astack_set_shrink(&stack, 1);
+
+	for (i = 0; i < 8 * ASTACK_DEFAULT_CAPACITY; i++) {
+		astack_push(&stack, (void *)i);
+	}
+
+	capacity = astack_capacity(&stack);
+
+	// Popping to just below half does not shrink, and pushing back does not grow
+	while ((size_t)astack_size(&stack) > capacity / 2 - 1) {
+		astack_pop(&stack, &popped);
+	}
+
+	astack_push(&stack, NULL);
+	astack_push(&stack, NULL);
+	cr_expect(astack_capacity(&stack) == capacity, "capacity should not change around half full");
+
+	// Draining to a quarter halves the array
+	while ((size_t)astack_size(&stack) > capacity / 4) {
+		astack_pop(&stack, &popped);
+	}
+
+	cr_expect(astack_capacity(&stack) == capacity / 2, "capacity should halve at a quarter full");
+
+	// Draining completely stops at the default capacity
+	while (astack_size(&stack) > 0) {
+		astack_pop(&stack, &popped);
+	}
+
+	cr_expect(astack_capacity(&stack) == ASTACK_DEFAULT_CAPACITY, "capacity should not drop below the default");
+}
+
+Test(astack_tests, reserve)
+{
+	void *popped;
+	int i;
+
+	astack_set_shrink(&stack, 1);
+
+	cr_expect(astack_reserve(&stack, 1000) == 0, "reserve should return 0");
+	cr_expect(astack_capacity(&stack) == 1000, "capacity should be 1000");
+
+	for (i = 0; i < 1000; i++) {
+		astack_push(&stack, &items[0]);
+	}
+
+	cr_expect(astack_capacity(&stack) == 1000, "reserved capacity should not need to grow");
+
+	while (astack_size(&stack) > 0) {
+		astack_pop(&stack, &popped);
+	}
+
+	cr_expect(astack_capacity(&stack) == 1000, "shrinking should stop at the reserved capacity");
+}
+
+Test(astack_tests, destroy_data)
+{
+	AStack owned;
+	int i;
+
+	astack_init(&owned, free);
+
+	for (i = 0; i < 3; i++) {
+		astack_push(&owned, malloc(sizeof (int)));
+	}
+
+	astack_destroy(&owned);
+	cr_expect(astack_size(&owned) == 0 && owned.data == NULL, "destroyed stack should be cleared");
+}
@@ -0,0 +1,202 @@
+/**
+ * \file bqueue_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for blocking Queue
+ */
+#include <criterion/criterion.h>
+
+#include <pthread.h>
+#include <time.h>
+
+#include "../src/bqueue.h"
+
+#define TRANSFER_COUNT 100000L
+
+BQueue queue;
+
+int items[3] = { 1, 2, 3 };
+
+static double
+now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void
+suite_setup()
+{
+	bqueue_init(&queue, NULL, 0);
+}
+
+void
+suite_teardown()
+{
+	bqueue_destroy(&queue);
+}
+
+TestSuite(bqueue_tests, .init=suite_setup, .fini=suite_teardown);
+
+Test(bqueue_tests, enqueue_dequeue)
+{
+	void *dequeued;
+	int i;
+
+	for (i = 0; i < 3; i++) {
+		cr_expect(bqueue_enqueue(&queue, &items[i]) == 0, "enqueue should return 0");
+	}
+
+	cr_expect(bqueue_size(&queue) == 3, "queue's size should be 3");
+
+	for (i = 0; i < 3; i++) {
+		cr_expect(bqueue_dequeue(&queue, &dequeued) == 0, "dequeue should return 0");
+		cr_expect(dequeued == &items[i], "dequeue should return items in order");
+	}
+}
+
+Test(bqueue_tests, timeout)
+{
+	void *dequeued;
+	double start;
+
+	cr_expect(bqueue_dequeue_timed(&queue, &dequeued, 0) == -1, "non-blocking dequeue from empty queue should fail");
+
+	start = now();
+	cr_expect(bqueue_dequeue_timed(&queue, &dequeued, 50) == -1, "timed dequeue from empty queue should fail");
+	cr_expect(now() - start >= 0.045, "timed dequeue should wait for the timeout");
+	cr_expect(bqueue_is_closed(&queue) == 0, "a timeout should not close the queue");
+}
+
+Test(bqueue_tests, bounded)
+{
+	BQueue bounded;
+	void *dequeued;
+
+	bqueue_init(&bounded, NULL, 2);
+
+	cr_expect(bqueue_enqueue_timed(&bounded, &items[0], 0) == 0, "enqueue with room should return 0");
+	cr_expect(bqueue_enqueue_timed(&bounded, &items[1], 0) == 0, "enqueue with room should return 0");
+	cr_expect(bqueue_enqueue_timed(&bounded, &items[2], 10) == -1, "enqueue onto full queue should time out");
+
+	bqueue_dequeue(&bounded, &dequeued);
+	cr_expect(bqueue_enqueue_timed(&bounded, &items[2], 0) == 0, "enqueue after dequeue should return 0");
+
+	bqueue_destroy(&bounded);
+}
+
+static void *
+consumer_run(void *arg)
+{
+	long count = 0, expected = 1;
+	void *dequeued;
+
+	// Runs until the queue is closed and drained
+	while (bqueue_dequeue(&queue, &dequeued) == 0) {
+		if (dequeued == (void *)expected) {
+			expected++;
+		}
+
+		count++;
+	}
+
+	return (void *)(count == expected - 1 ? count : -1);
+}
+
+Test(bqueue_tests, close_wakes_consumer)
+{
+	pthread_t consumer;
+	void *count;
+	long i;
+
+	pthread_create(&consumer, NULL, consumer_run, NULL);
+
+	for (i = 1; i <= TRANSFER_COUNT; i++) {
+		bqueue_enqueue(&queue, (void *)i);
+	}
+
+	bqueue_close(&queue);
+	cr_expect(bqueue_enqueue(&queue, &items[0]) == -1, "enqueue onto closed queue should return -1");
+
+	pthread_join(consumer, &count);
+	cr_expect(count == (void *)TRANSFER_COUNT, "consumer should receive every item in order before exiting");
+	cr_expect(bqueue_is_closed(&queue) == 1, "queue should be closed");
+}
+
+static void *
+blocked_producer_run(void *arg)
+{
+	BQueue *bounded = (BQueue *)arg;
+
+	return (void *)(long)bqueue_enqueue(bounded, &items[1]);
+}
+
+Test(bqueue_tests, close_wakes_producer)
+{
+	pthread_t producer;
+	BQueue bounded;
+	void *result;
+
+	bqueue_init(&bounded, NULL, 1);
+	bqueue_enqueue(&bounded, &items[0]);
+
+	pthread_create(&producer, NULL, blocked_producer_run, &bounded);
+	bqueue_close(&bounded);
+	pthread_join(producer, &result);
+
+	cr_expect(result == (void *)-1L, "blocked enqueue should fail once the queue is closed");
+
+	bqueue_destroy(&bounded);
+}
+
+static void *
+batch_consumer_run(void *arg)
+{
+	BQueue *bounded = (BQueue *)arg;
+	long count = 0, expected = 1;
+	void *dequeued[3];
+	int n, i;
+
+	// Runs until the queue is closed and drained
+	while ((n = bqueue_dequeue_n(bounded, dequeued, 3)) > 0) {
+		for (i = 0; i < n; i++) {
+			if (dequeued[i] == (void *)expected) {
+				expected++;
+			}
+		}
+
+		count += n;
+	}
+
+	return (void *)(count == expected - 1 ? count : -1);
+}
+
+Test(bqueue_tests, batch)
+{
+	static void *batch[TRANSFER_COUNT];
+	pthread_t consumer;
+	BQueue bounded;
+	void *count;
+	long i;
+
+	for (i = 0; i < TRANSFER_COUNT; i++) {
+		batch[i] = (void *)(i + 1);
+	}
+
+	// The batch is far larger than the queue, so the producer has to wait for room repeatedly
+	bqueue_init(&bounded, NULL, 4);
+	pthread_create(&consumer, NULL, batch_consumer_run, &bounded);
+
+	cr_expect(bqueue_enqueue_n(&bounded, batch, TRANSFER_COUNT) == TRANSFER_COUNT,
+	          "batch enqueue should enqueue every item");
+
+	bqueue_close(&bounded);
+	cr_expect(bqueue_enqueue_n(&bounded, batch, 2) == 0, "batch enqueue onto closed queue should return 0");
+
+	pthread_join(consumer, &count);
+	cr_expect(count == (void *)TRANSFER_COUNT, "consumer should receive every item in order");
+
+	bqueue_destroy(&bounded);
+}
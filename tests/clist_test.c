@@ -260,3 +260,180 @@ Test(list_tests, remove_at_head)
 	cr_expect(removed == item1, "removed item should point to the first item inserted");
 	cr_expect(clist_head(&list) == NULL, "empty dlist's head should be NULL");
 }
+
+// Build a circular linked-list holding pointers to `values[0]` .. `values[count - 1]`
+static void
+fill_list(CList *target, int *values, int count)
+{
+	CList_Element *last = NULL;
+	int i;
+
+	clist_init(target, NULL);
+
+	for (i = 0; i < count; i++) {
+		clist_insert_next(target, last, &values[i]);
+		last = i == 0 ? clist_head(target) : clist_next(last);
+	}
+}
+
+// Determine whether a circular linked-list holds exactly `expected[0]` .. `expected[count - 1]` in order
+static int
+holds(CList *target, int *const *expected, int count)
+{
+	CList_Element *element = clist_head(target);
+	int i;
+
+	if (clist_size(target) != count) {
+		return 0;
+	}
+
+	for (i = 0; i < count; i++, element = clist_next(element)) {
+		if (clist_data(element) != expected[i]) {
+			return 0;
+		}
+	}
+
+	// The ring must close back at the head
+	if (count > 0 && element != clist_head(target)) {
+		return 0;
+	}
+
+	return 1;
+}
+
+Test(list_tests, splice_concat_split)
+{
+	CList first, second, rest, pooled;
+	int a[3] = { 1, 2, 3 }, b[2] = { 4, 5 };
+	int *spliced[5] = { &a[0], &b[0], &b[1], &a[1], &a[2] };
+	int *joined[7] = { &a[0], &b[0], &b[1], &a[1], &a[2], &b[0], &b[1] };
+	CList_Element *element;
+	int i;
+
+	fill_list(&first, a, 3);
+	fill_list(&second, b, 2);
+
+	// Splice into the middle
+	cr_expect(clist_splice(&first, clist_head(&first), &second) == 0, "splice should return 0");
+	cr_expect(holds(&first, spliced, 5), "spliced elements should follow the given element");
+	cr_expect(clist_size(&second) == 0 && clist_head(&second) == NULL, "spliced list should be empty");
+	cr_expect(clist_splice(&first, clist_head(&first), &first) == -1, "splice into itself should fail");
+
+	// Concatenate onto the end
+	fill_list(&second, b, 2);
+	cr_expect(clist_concat(&first, &second) == 0, "concat should return 0");
+	cr_expect(holds(&first, joined, 7), "concatenated elements should follow the last element");
+
+	// Split the concatenated elements back off
+	for (i = 0, element = clist_head(&first); i < 4; i++) {
+		element = clist_next(element);
+	}
+
+	clist_init(&rest, NULL);
+	cr_expect(clist_split(&first, element, &rest) == 0, "split should return 0");
+	cr_expect(holds(&first, spliced, 5), "split list should keep the elements up to the split");
+	cr_expect(holds(&rest, &joined[5], 2), "other list should receive the rest");
+	cr_expect(clist_split(&first, NULL, &rest) == -1, "split into non-empty list should fail");
+
+	// Concatenating onto an empty list takes the other list over
+	cr_expect(clist_concat(&second, &rest) == 0, "concat onto empty list should return 0");
+	cr_expect(holds(&second, &joined[5], 2), "empty list should take over the elements");
+
+	// Lists with different storage cannot trade elements
+	cr_expect(clist_init_arena(&pooled, NULL, 0) == 0, "arena list init should return 0");
+	cr_expect(clist_concat(&pooled, &second) == -1, "concat across allocators should fail");
+	cr_expect(clist_size(&second) == 2, "failed concat should leave the other list alone");
+
+	// Arena lists cannot trade elements even through a shared arena, which each would release
+	clist_insert_next(&pooled, NULL, &a[0]);
+	rest.allocator = pooled.allocator;
+	cr_expect(clist_splice(&pooled, NULL, &rest) == -1, "splice between arena lists should fail");
+	cr_expect(clist_split(&pooled, NULL, &rest) == -1, "split between arena lists should fail");
+	cr_expect(clist_size(&pooled) == 1 && clist_size(&rest) == 0, "failed split should leave both lists alone");
+	rest.allocator = allocator_default;
+
+	clist_destroy(&pooled);
+	clist_destroy(&rest);
+	clist_destroy(&second);
+	clist_destroy(&first);
+}
+
+static int destroyed;
+
+static void
+count_destroy(void *data)
+{
+	destroyed++;
+}
+
+static int
+match_int(const void *key, const void *data)
+{
+	return *(const int *)key == *(const int *)data;
+}
+
+Test(list_tests, find_count_remove_matching)
+{
+	CList searched;
+	int values[6] = { 7, 1, 7, 2, 7, 3 };
+	int *remaining[3] = { &values[1], &values[3], &values[5] };
+	int key = 7, missing = 4;
+	CList_Element *found;
+	int i;
+
+	fill_list(&searched, values, 6);
+	searched.destroy = count_destroy;
+	destroyed = 0;
+
+	cr_expect(searched.match == NULL, "init should clear the match function");
+	cr_expect(clist_find(&searched, &key) == NULL, "find without a match function should return NULL");
+	cr_expect(clist_count(&searched, &key) == -1, "count without a match function should return -1");
+	cr_expect(clist_remove_matching(&searched, &key) == -1, "remove without a match function should return -1");
+
+	clist_set_match(&searched, match_int);
+
+	// Walk the matches with find/find_next
+	found = clist_find(&searched, &key);
+	cr_expect(found != NULL && clist_data(found) == &values[0], "find should return the first match");
+
+	for (i = 2; i <= 4; i += 2) {
+		found = clist_find_next(&searched, found, &key);
+		cr_expect(found != NULL && clist_data(found) == &values[i], "find_next should return the next match");
+	}
+
+	cr_expect(clist_find_next(&searched, found, &key) == NULL, "find_next past the last match should return NULL");
+	cr_expect(clist_find(&searched, &missing) == NULL, "find of a missing key should return NULL");
+
+	cr_expect(clist_count(&searched, &key) == 3, "count should return the number of matches");
+	cr_expect(clist_count(&searched, &missing) == 0, "count of a missing key should return 0");
+
+	// Removing the matches leaves the others in order
+	cr_expect(clist_remove_matching(&searched, &key) == 3, "remove should return the number removed");
+	cr_expect(destroyed == 3, "destroy should be called for each removed element");
+	cr_expect(holds(&searched, remaining, 3), "remaining elements should keep their order");
+
+	// Removing every element empties the list
+	key = 1;
+	clist_remove_matching(&searched, &key);
+	key = 2;
+	clist_remove_matching(&searched, &key);
+	key = 3;
+	cr_expect(clist_remove_matching(&searched, &key) == 1, "remove of the last element should return 1");
+	cr_expect(clist_size(&searched) == 0 && clist_head(&searched) == NULL, "list should be empty");
+
+	clist_destroy(&searched);
+
+	// A match on the last element must not wrap around to the head
+	fill_list(&searched, values, 3);
+	clist_set_match(&searched, match_int);
+	key = 7;
+	i = 0;
+
+	for (found = clist_find(&searched, &key); found != NULL && i <= 3; found = clist_find_next(&searched, found, &key)) {
+		i++;
+	}
+
+	cr_expect(found == NULL && i == 2, "find/find_next should stop after the last element's match");
+
+	clist_destroy(&searched);
+}
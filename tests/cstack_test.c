@@ -0,0 +1,120 @@
+/**
+ * \file cstack_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for concurrent Stack
+ */
+#include <criterion/criterion.h>
+
+#include <pthread.h>
+#include <stdlib.h> // free()
+
+#include "../src/cstack.h"
+
+#define THREAD_COUNT 4
+#define OPERATION_COUNT 200000L
+
+CStack stack;
+
+int items[3] = { 1, 2, 3 };
+
+void
+suite_setup()
+{
+	cstack_init(&stack, NULL);
+}
+
+void
+suite_teardown()
+{
+	cstack_destroy(&stack);
+}
+
+TestSuite(cstack_tests, .init=suite_setup, .fini=suite_teardown);
+
+Test(cstack_tests, empty)
+{
+	void *popped;
+
+	cr_expect(cstack_is_empty(&stack) == 1, "new stack should be empty");
+	cr_expect(cstack_pop(&stack, &popped) == -1, "pop from empty stack should return -1");
+}
+
+Test(cstack_tests, push_pop)
+{
+	void *popped;
+	int i;
+
+	for (i = 0; i < 3; i++) {
+		cr_expect(cstack_push(&stack, &items[i]) == 0, "push should return 0");
+	}
+
+	cr_expect(cstack_is_empty(&stack) == 0, "stack should not be empty");
+
+	for (i = 2; i >= 0; i--) {
+		cr_expect(cstack_pop(&stack, &popped) == 0, "pop should return 0");
+		cr_expect(popped == &items[i], "pop should return items in reverse order");
+	}
+
+	cr_expect(cstack_is_empty(&stack) == 1, "stack should be empty again");
+}
+
+static void *
+churn_run(void *arg)
+{
+	long base = (long)arg * OPERATION_COUNT;
+	long *sum = (long *)malloc(sizeof (long));
+	void *popped;
+	long i;
+
+	*sum = 0;
+
+	// Push a value and pop one back, which may well be another thread's
+	for (i = 1; i <= OPERATION_COUNT; i++) {
+		cstack_push(&stack, (void *)(base + i));
+
+		if (cstack_pop(&stack, &popped) == 0) {
+			*sum += (long)popped;
+		}
+	}
+
+	return sum;
+}
+
+Test(cstack_tests, many_threads)
+{
+	pthread_t threads[THREAD_COUNT];
+	long total = 0, n = THREAD_COUNT * OPERATION_COUNT;
+	void *popped, *sum;
+	long i;
+
+	for (i = 0; i < THREAD_COUNT; i++) {
+		pthread_create(&threads[i], NULL, churn_run, (void *)i);
+	}
+
+	for (i = 0; i < THREAD_COUNT; i++) {
+		pthread_join(threads[i], &sum);
+		total += *(long *)sum;
+		free(sum);
+	}
+
+	while (cstack_pop(&stack, &popped) == 0) {
+		total += (long)popped;
+	}
+
+	cr_expect(total == n * (n + 1) / 2, "every value should be popped exactly once");
+}
+
+Test(cstack_tests, destroy_data)
+{
+	CStack owned;
+	int i;
+
+	cstack_init(&owned, free);
+
+	for (i = 0; i < 3; i++) {
+		cstack_push(&owned, malloc(sizeof (int)));
+	}
+
+	cstack_destroy(&owned);
+	cr_expect(cstack_is_empty(&owned) == 1, "destroyed stack should be cleared");
+}
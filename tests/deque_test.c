@@ -0,0 +1,129 @@
+/**
+ * \file deque_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for Deque ADT
+ */
+#include <criterion/criterion.h>
+
+#include <stdlib.h> // free()
+
+#include "../src/deque.h"
+
+Deque deque;
+
+int items[4] = { 1, 2, 3, 4 };
+
+void
+suite_setup()
+{
+	deque_init(&deque, NULL);
+}
+
+void
+suite_teardown()
+{
+	deque_destroy(&deque);
+}
+
+TestSuite(deque_tests, .init=suite_setup, .fini=suite_teardown);
+
+Test(deque_tests, empty)
+{
+	void *removed;
+
+	cr_expect(deque_size(&deque) == 0, "empty deque's size should be 0");
+	cr_expect(deque_head(&deque) == -1, "empty deque should have no head");
+	cr_expect(deque_tail(&deque) == -1, "empty deque should have no tail");
+	cr_expect(deque_peek_front(&deque) == NULL, "empty deque's front should be NULL");
+	cr_expect(deque_peek_back(&deque) == NULL, "empty deque's back should be NULL");
+	cr_expect(deque_pop_front(&deque, &removed) == -1, "pop front from empty deque should return -1");
+	cr_expect(deque_pop_back(&deque, &removed) == -1, "pop back from empty deque should return -1");
+}
+
+Test(deque_tests, push_pop_both_ends)
+{
+	void *removed;
+
+	// Build 1 2 3 4 from the middle outwards
+	cr_expect(deque_push_back(&deque, &items[2]) == 0, "push back should return 0");
+	cr_expect(deque_push_front(&deque, &items[1]) == 0, "push front should return 0");
+	cr_expect(deque_push_back(&deque, &items[3]) == 0, "push back should return 0");
+	cr_expect(deque_push_front(&deque, &items[0]) == 0, "push front should return 0");
+
+	cr_expect(deque_size(&deque) == 4, "deque's size should be 4");
+	cr_expect(deque_peek_front(&deque) == &items[0], "front should be the last item pushed to the front");
+	cr_expect(deque_peek_back(&deque) == &items[3], "back should be the last item pushed to the back");
+	cr_expect(deque_at(&deque, 2) == &items[2], "indexed access should follow deque order");
+
+	cr_expect(deque_pop_back(&deque, &removed) == 0 && removed == &items[3], "pop back should return the back");
+	cr_expect(deque_pop_front(&deque, &removed) == 0 && removed == &items[0], "pop front should return the front");
+	cr_expect(deque_pop_back(&deque, &removed) == 0 && removed == &items[2], "pop back should return the back");
+	cr_expect(deque_pop_back(&deque, &removed) == 0 && removed == &items[1], "pop back should return the last item");
+	cr_expect(deque_size(&deque) == 0, "deque should be empty again");
+}
+
+Test(deque_tests, iterate)
+{
+	int index, i;
+
+	for (i = 3; i >= 0; i--) {
+		deque_push_front(&deque, &items[i]);
+	}
+
+	for (i = 0, index = deque_head(&deque); index != -1; index = deque_next(&deque, index)) {
+		cr_expect(deque_data(&deque, index) == &items[i], "forward element %d should be item %d", i, i);
+		cr_expect(deque_is_head(&deque, index) == (i == 0), "only the first position should be the head");
+		i++;
+	}
+
+	cr_expect(i == 4, "forward walk should visit every element");
+
+	for (index = deque_tail(&deque); index != -1; index = deque_prev(&deque, index)) {
+		i--;
+		cr_expect(deque_data(&deque, index) == &items[i], "backward element %d should be item %d", i, i);
+		cr_expect(deque_is_tail(&deque, index) == (i == 3), "only the last position should be the tail");
+	}
+
+	cr_expect(i == 0, "backward walk should visit every element");
+}
+
+Test(deque_tests, grow_while_wrapped)
+{
+	void *removed;
+	long i;
+
+	// Pushing to the front first wraps the head to the end of the buffer
+	for (i = 0; i < 3 * DEQUE_DEFAULT_CAPACITY; i++) {
+		if (i % 2 == 0) {
+			cr_expect(deque_push_front(&deque, (void *)(-i)) == 0, "push front should return 0");
+		} else {
+			cr_expect(deque_push_back(&deque, (void *)i) == 0, "push back should return 0");
+		}
+	}
+
+	cr_expect(deque_capacity(&deque) == 4 * DEQUE_DEFAULT_CAPACITY, "buffer should have doubled twice");
+
+	for (i = 0; i < deque_size(&deque) - 1; i++) {
+		cr_expect((long)deque_at(&deque, i) < (long)deque_at(&deque, i + 1), "elements should stay in order across growth");
+	}
+
+	cr_expect(deque_pop_front(&deque, &removed) == 0 && removed == (void *)(-(3L * DEQUE_DEFAULT_CAPACITY - 2)),
+	          "front should be the last item pushed to the front");
+	cr_expect(deque_pop_back(&deque, &removed) == 0 && removed == (void *)(3L * DEQUE_DEFAULT_CAPACITY - 1),
+	          "back should be the last item pushed to the back");
+}
+
+Test(deque_tests, destroy_data)
+{
+	Deque owned;
+	int i;
+
+	deque_init(&owned, free);
+
+	for (i = 0; i < 3; i++) {
+		deque_push_back(&owned, malloc(sizeof (int)));
+	}
+
+	deque_destroy(&owned);
+	cr_expect(deque_size(&owned) == 0 && owned.data == NULL, "destroyed deque should be cleared");
+}
@@ -41,6 +41,18 @@ int *item3 = NULL;
 // 	}
 // }
 
+typedef struct Record_s {
+	int key;
+	int order;
+
+} Record;
+
+static int
+compare_records(const void *key1, const void *key2)
+{
+	return ((const Record *)key1)->key - ((const Record *)key2)->key;
+}
+
 void suite_setup()
 {
 	item1 = (int*)malloc(sizeof (int));
@@ -452,4 +464,261 @@ Test(list_tests, remove_in_middle)
 	cr_expect(dlist_data(dlist_head(&list)) == item1, "head should be the first item inserted");
 	cr_expect(dlist_data(dlist_tail(&list)) == item3, "tail should be the third item inserted");
 	cr_expect(removed == item2, "removed item should point to the second item inserted");
-}
\ No newline at end of file
+}
+
+// Check that the list is in key order, equal keys in insertion order, with intact links
+static void
+expect_sorted(DList *sorted, int count)
+{
+	DList_Element *element, *last = NULL;
+	Record *previous = NULL, *current;
+	int i, disorder = 0, unstable = 0, broken = 0;
+
+	for (i = 0, element = dlist_head(sorted); element != NULL; i++, element = dlist_next(element)) {
+		current = (Record *)dlist_data(element);
+
+		if (previous != NULL) {
+			disorder |= previous->key > current->key;
+			unstable |= previous->key == current->key && previous->order > current->order;
+		}
+
+		broken |= dlist_prev(element) != last;
+		last = element;
+		previous = current;
+	}
+
+	cr_expect(disorder == 0, "keys should be in ascending order");
+	cr_expect(unstable == 0, "equal keys should keep their insertion order");
+	cr_expect(broken == 0, "prev links should be rebuilt");
+	cr_expect(dlist_tail(sorted) == last, "tail should be the last element");
+	cr_expect(i == count && dlist_size(sorted) == count, "every element should still be linked");
+}
+
+Test(list_tests, sort)
+{
+	DList sorted;
+	Record records[100];
+	int i;
+
+	dlist_init(&sorted, NULL);
+
+	// Sorting an empty list is a no-op
+	dlist_sort(&sorted, compare_records);
+	cr_expect(dlist_head(&sorted) == NULL && dlist_tail(&sorted) == NULL, "empty list should stay empty");
+
+	// Few distinct keys, so stability is exercised
+	for (i = 0; i < 100; i++) {
+		records[i].key = (i * 37) % 10;
+		records[i].order = i;
+		dlist_insert_next(&sorted, dlist_tail(&sorted), &records[i]);
+	}
+
+	dlist_sort(&sorted, compare_records);
+	expect_sorted(&sorted, 100);
+
+	dlist_destroy(&sorted);
+}
+
+Test(list_tests, sort_parallel)
+{
+	int count = DLIST_SORT_PARALLEL_THRESHOLD * 3;
+	int threads[4] = { 1, 2, 3, 8 };
+	Record *records;
+	DList sorted;
+	int i, t;
+
+	records = (Record *)malloc(count * sizeof (Record));
+
+	for (t = 0; t < 4; t++) {
+		dlist_init(&sorted, NULL);
+
+		for (i = 0; i < count; i++) {
+			records[i].key = (int)((i * 2654435761u) % 1000);
+			records[i].order = i;
+			dlist_insert_next(&sorted, dlist_tail(&sorted), &records[i]);
+		}
+
+		dlist_sort_parallel(&sorted, compare_records, threads[t]);
+		expect_sorted(&sorted, count);
+
+		dlist_destroy(&sorted);
+	}
+
+	// Below the threshold the serial path is taken
+	dlist_init(&sorted, NULL);
+
+	for (i = 0; i < 100; i++) {
+		records[i].key = 100 - i;
+		records[i].order = i;
+		dlist_insert_next(&sorted, dlist_tail(&sorted), &records[i]);
+	}
+
+	dlist_sort_parallel(&sorted, compare_records, 4);
+	expect_sorted(&sorted, 100);
+
+	dlist_destroy(&sorted);
+	free(records);
+}
+
+// Build a doubly linked-list holding pointers to `values[0]` .. `values[count - 1]`
+static void
+fill_list(DList *target, int *values, int count)
+{
+	int i;
+
+	dlist_init(target, NULL);
+
+	for (i = 0; i < count; i++) {
+		dlist_insert_next(target, dlist_tail(target), &values[i]);
+	}
+}
+
+// Determine whether a doubly linked-list holds exactly `expected[0]` .. `expected[count - 1]` in order
+static int
+holds(DList *target, int *const *expected, int count)
+{
+	DList_Element *element = dlist_head(target);
+	int i;
+
+	if (dlist_size(target) != count) {
+		return 0;
+	}
+
+	for (i = 0; i < count; i++, element = dlist_next(element)) {
+		if (dlist_data(element) != expected[i]) {
+			return 0;
+		}
+	}
+
+	// Walk back from the tail to check the prev links too
+	for (i = count - 1, element = dlist_tail(target); i >= 0; i--, element = dlist_prev(element)) {
+		if (dlist_data(element) != expected[i]) {
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+Test(list_tests, splice_concat_split)
+{
+	DList first, second, rest, pooled;
+	int a[3] = { 1, 2, 3 }, b[2] = { 4, 5 };
+	int *spliced[5] = { &a[0], &b[0], &b[1], &a[1], &a[2] };
+	int *joined[7] = { &a[0], &b[0], &b[1], &a[1], &a[2], &b[0], &b[1] };
+	DList_Element *element;
+	int i;
+
+	fill_list(&first, a, 3);
+	fill_list(&second, b, 2);
+
+	// Splice into the middle
+	cr_expect(dlist_splice(&first, dlist_head(&first), &second) == 0, "splice should return 0");
+	cr_expect(holds(&first, spliced, 5), "spliced elements should follow the given element");
+	cr_expect(dlist_size(&second) == 0 && dlist_head(&second) == NULL, "spliced list should be empty");
+	cr_expect(dlist_splice(&first, dlist_head(&first), &first) == -1, "splice into itself should fail");
+
+	// Concatenate onto the end
+	fill_list(&second, b, 2);
+	cr_expect(dlist_concat(&first, &second) == 0, "concat should return 0");
+	cr_expect(holds(&first, joined, 7), "concatenated elements should follow the last element");
+
+	// Split the concatenated elements back off
+	for (i = 0, element = dlist_head(&first); i < 4; i++) {
+		element = dlist_next(element);
+	}
+
+	dlist_init(&rest, NULL);
+	cr_expect(dlist_split(&first, element, &rest) == 0, "split should return 0");
+	cr_expect(holds(&first, spliced, 5), "split list should keep the elements up to the split");
+	cr_expect(holds(&rest, &joined[5], 2), "other list should receive the rest");
+	cr_expect(dlist_split(&first, NULL, &rest) == -1, "split into non-empty list should fail");
+
+	// Concatenating onto an empty list takes the other list over
+	cr_expect(dlist_concat(&second, &rest) == 0, "concat onto empty list should return 0");
+	cr_expect(holds(&second, &joined[5], 2), "empty list should take over the elements");
+
+	// Lists with different storage cannot trade elements
+	cr_expect(dlist_init_arena(&pooled, NULL, 0) == 0, "arena list init should return 0");
+	cr_expect(dlist_concat(&pooled, &second) == -1, "concat across allocators should fail");
+	cr_expect(dlist_size(&second) == 2, "failed concat should leave the other list alone");
+
+	// Arena lists cannot trade elements even through a shared arena, which each would release
+	dlist_insert_next(&pooled, NULL, &a[0]);
+	rest.allocator = pooled.allocator;
+	cr_expect(dlist_splice(&pooled, NULL, &rest) == -1, "splice between arena lists should fail");
+	cr_expect(dlist_split(&pooled, NULL, &rest) == -1, "split between arena lists should fail");
+	cr_expect(dlist_size(&pooled) == 1 && dlist_size(&rest) == 0, "failed split should leave both lists alone");
+	rest.allocator = allocator_default;
+
+	dlist_destroy(&pooled);
+	dlist_destroy(&rest);
+	dlist_destroy(&second);
+	dlist_destroy(&first);
+}
+
+static int destroyed;
+
+static void
+count_destroy(void *data)
+{
+	destroyed++;
+}
+
+static int
+match_int(const void *key, const void *data)
+{
+	return *(const int *)key == *(const int *)data;
+}
+
+Test(list_tests, find_count_remove_matching)
+{
+	DList searched;
+	int values[6] = { 7, 1, 7, 2, 7, 3 };
+	int *remaining[3] = { &values[1], &values[3], &values[5] };
+	int key = 7, missing = 4;
+	DList_Element *found;
+	int i;
+
+	fill_list(&searched, values, 6);
+	searched.destroy = count_destroy;
+	destroyed = 0;
+
+	cr_expect(searched.match == NULL, "init should clear the match function");
+	cr_expect(dlist_find(&searched, &key) == NULL, "find without a match function should return NULL");
+	cr_expect(dlist_count(&searched, &key) == -1, "count without a match function should return -1");
+	cr_expect(dlist_remove_matching(&searched, &key) == -1, "remove without a match function should return -1");
+
+	dlist_set_match(&searched, match_int);
+
+	// Walk the matches with find/find_next
+	found = dlist_find(&searched, &key);
+	cr_expect(found != NULL && dlist_data(found) == &values[0], "find should return the first match");
+
+	for (i = 2; i <= 4; i += 2) {
+		found = dlist_find_next(&searched, found, &key);
+		cr_expect(found != NULL && dlist_data(found) == &values[i], "find_next should return the next match");
+	}
+
+	cr_expect(dlist_find_next(&searched, found, &key) == NULL, "find_next past the last match should return NULL");
+	cr_expect(dlist_find(&searched, &missing) == NULL, "find of a missing key should return NULL");
+
+	cr_expect(dlist_count(&searched, &key) == 3, "count should return the number of matches");
+	cr_expect(dlist_count(&searched, &missing) == 0, "count of a missing key should return 0");
+
+	// Removing the matches leaves the others in order
+	cr_expect(dlist_remove_matching(&searched, &key) == 3, "remove should return the number removed");
+	cr_expect(destroyed == 3, "destroy should be called for each removed element");
+	cr_expect(holds(&searched, remaining, 3), "remaining elements should keep their order");
+
+	// Removing every element empties the list
+	key = 1;
+	dlist_remove_matching(&searched, &key);
+	key = 2;
+	dlist_remove_matching(&searched, &key);
+	key = 3;
+	cr_expect(dlist_remove_matching(&searched, &key) == 1, "remove of the last element should return 1");
+	cr_expect(dlist_size(&searched) == 0 && dlist_head(&searched) == NULL, "list should be empty");
+
+	dlist_destroy(&searched);
+}
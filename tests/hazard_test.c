@@ -0,0 +1,107 @@
+/**
+ * \file hazard_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for hazard pointers
+ */
+#include <criterion/criterion.h>
+
+#include <pthread.h>
+
+#include "../src/hazard.h"
+
+static int reclaimed[HAZARD_RETIRE_THRESHOLD * 2];
+
+static void
+mark_reclaimed(void *ptr)
+{
+	*(int *)ptr = 1;
+}
+
+void
+suite_setup()
+{
+	int i;
+
+	for (i = 0; i < HAZARD_RETIRE_THRESHOLD * 2; i++) {
+		reclaimed[i] = 0;
+	}
+}
+
+void
+suite_teardown()
+{
+	hazard_clear(0);
+	hazard_clear(1);
+}
+
+TestSuite(hazard_tests, .init=suite_setup, .fini=suite_teardown);
+
+Test(hazard_tests, collect_unprotected)
+{
+	hazard_retire(&reclaimed[0], mark_reclaimed);
+	cr_expect(reclaimed[0] == 0, "retired block should wait for a scan");
+
+	hazard_collect();
+	cr_expect(reclaimed[0] == 1, "unprotected block should be reclaimed by a scan");
+}
+
+Test(hazard_tests, protected_until_cleared)
+{
+	cr_expect(hazard_set(1, &reclaimed[0]) == 0, "set should return 0");
+
+	hazard_retire(&reclaimed[0], mark_reclaimed);
+	hazard_retire(&reclaimed[1], mark_reclaimed);
+	hazard_collect();
+	cr_expect(reclaimed[0] == 0, "protected block should not be reclaimed");
+	cr_expect(reclaimed[1] == 1, "unprotected block should be reclaimed");
+
+	hazard_clear(1);
+	hazard_collect();
+	cr_expect(reclaimed[0] == 1, "block should be reclaimed once its hazard is cleared");
+}
+
+Test(hazard_tests, threshold_scan)
+{
+	int i;
+
+	for (i = 0; i < HAZARD_RETIRE_THRESHOLD; i++) {
+		hazard_retire(&reclaimed[i], mark_reclaimed);
+	}
+
+	cr_expect(reclaimed[0] == 1, "reaching the threshold should trigger a scan");
+}
+
+static void *
+protect_run(void *arg)
+{
+	hazard_set(0, arg);
+
+	return NULL;
+}
+
+static void *
+retire_run(void *arg)
+{
+	hazard_retire(arg, mark_reclaimed);
+
+	return NULL;
+}
+
+Test(hazard_tests, other_threads)
+{
+	pthread_t thread;
+
+	// A hazard published by a live thread holds, but goes away when the thread exits
+	cr_expect(hazard_set(0, &reclaimed[0]) == 0, "set should return 0");
+
+	pthread_create(&thread, NULL, retire_run, &reclaimed[0]);
+	pthread_join(thread, NULL);
+	cr_expect(reclaimed[0] == 0, "block protected by another thread should survive its exit scan");
+
+	hazard_clear(0);
+
+	// The retired block was left on the exited thread's record and a new thread takes it over
+	pthread_create(&thread, NULL, protect_run, NULL);
+	pthread_join(thread, NULL);
+	cr_expect(reclaimed[0] == 1, "leftover block should be reclaimed by the next thread's exit scan");
+}
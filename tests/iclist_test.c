@@ -0,0 +1,76 @@
+/**
+ * \file iclist_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for intrusive Circular linked-list ADT
+ */
+#include <criterion/criterion.h>
+
+#include "../src/iclist.h"
+
+typedef struct Item_s {
+	int value;
+	ICList_Link link;
+
+} Item;
+
+ICList list;
+
+Item item1 = { 1 };
+Item item2 = { 2 };
+Item item3 = { 3 };
+
+void
+suite_setup()
+{
+	iclist_init(&list);
+}
+
+TestSuite(iclist_tests, .init=suite_setup);
+
+Test(iclist_tests, empty)
+{
+	ICList_Link *removed;
+
+	cr_expect(iclist_size(&list) == 0, "empty list's size should be 0");
+	cr_expect(iclist_head(&list) == NULL, "empty list's head should be NULL");
+	cr_expect(iclist_remove_next(&list, NULL, &removed) == -1, "remove from empty list should return -1");
+}
+
+Test(iclist_tests, insert_and_circle)
+{
+	ICList_Link *link;
+	int i;
+
+	cr_expect(iclist_insert_next(&list, NULL, &item1.link) == 0, "insert into empty list should return 0");
+	cr_expect(iclist_next(iclist_head(&list)) == iclist_head(&list), "single link should point to itself");
+
+	cr_expect(iclist_insert_next(&list, iclist_head(&list), &item3.link) == 0, "insert after head should return 0");
+	cr_expect(iclist_insert_next(&list, iclist_head(&list), &item2.link) == 0, "insert after head should return 0");
+	cr_expect(iclist_size(&list) == 3, "list's size should be 3");
+
+	// Circle twice
+	link = iclist_head(&list);
+
+	for (i = 0; i < 6; i++) {
+		cr_expect(iclist_entry(link, Item, link)->value == (i % 3) + 1, "links should circle in order");
+		link = iclist_next(link);
+	}
+}
+
+Test(iclist_tests, remove)
+{
+	ICList_Link *removed;
+
+	iclist_insert_next(&list, NULL, &item1.link);
+	iclist_insert_next(&list, iclist_head(&list), &item2.link);
+
+	// Removing after the last link removes the head
+	cr_expect(iclist_remove_next(&list, &item2.link, &removed) == 0, "remove should return 0");
+	cr_expect(removed == &item1.link, "removed link should be item 1's");
+	cr_expect(iclist_head(&list) == &item2.link, "head should move on");
+	cr_expect(iclist_next(iclist_head(&list)) == iclist_head(&list), "single link should point to itself");
+
+	cr_expect(iclist_remove_next(&list, iclist_head(&list), &removed) == 0, "remove should return 0");
+	cr_expect(removed == &item2.link, "removed link should be item 2's");
+	cr_expect(iclist_head(&list) == NULL, "list should be empty");
+}
@@ -0,0 +1,72 @@
+/**
+ * \file idlist_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for intrusive Doubly linked-list ADT
+ */
+#include <criterion/criterion.h>
+
+#include "../src/idlist.h"
+
+typedef struct Item_s {
+	int value;
+	IDList_Link link;
+
+} Item;
+
+IDList list;
+
+Item item1 = { 1 };
+Item item2 = { 2 };
+Item item3 = { 3 };
+
+void
+suite_setup()
+{
+	idlist_init(&list);
+}
+
+TestSuite(idlist_tests, .init=suite_setup);
+
+Test(idlist_tests, empty)
+{
+	cr_expect(idlist_size(&list) == 0, "empty list's size should be 0");
+	cr_expect(idlist_head(&list) == NULL, "empty list's head should be NULL");
+	cr_expect(idlist_tail(&list) == NULL, "empty list's tail should be NULL");
+	cr_expect(idlist_remove(&list, &item1.link) == -1, "remove from empty list should return -1");
+}
+
+Test(idlist_tests, insert)
+{
+	cr_expect(idlist_insert_next(&list, NULL, &item2.link) == 0, "insert into empty list should return 0");
+	cr_expect(idlist_insert_next(&list, NULL, &item3.link) == -1, "NULL link into non-empty list should return -1");
+	cr_expect(idlist_insert_prev(&list, idlist_head(&list), &item1.link) == 0, "insert before head should return 0");
+	cr_expect(idlist_insert_next(&list, idlist_tail(&list), &item3.link) == 0, "insert after tail should return 0");
+	cr_expect(idlist_size(&list) == 3, "list's size should be 3");
+	//    h         t
+	//    [1]->[2]->[3]->0
+	// 0<-[ ]<-[ ]<-[ ]
+
+	cr_expect(idlist_entry(idlist_head(&list), Item, link)->value == 1, "head should be item 1");
+	cr_expect(idlist_entry(idlist_tail(&list), Item, link)->value == 3, "tail should be item 3");
+	cr_expect(idlist_prev(idlist_tail(&list)) == &item2.link, "tail's prev should be item 2");
+	cr_expect(idlist_is_head(idlist_head(&list)) == 1, "head should be at the head of the list");
+	cr_expect(idlist_is_tail(idlist_tail(&list)) == 1, "tail should be at the tail of the list");
+}
+
+Test(idlist_tests, remove)
+{
+	idlist_insert_next(&list, NULL, &item1.link);
+	idlist_insert_next(&list, idlist_tail(&list), &item2.link);
+	idlist_insert_next(&list, idlist_tail(&list), &item3.link);
+
+	cr_expect(idlist_remove(&list, &item2.link) == 0, "remove in between should return 0");
+	cr_expect(idlist_next(&item1.link) == &item3.link, "neighbours should be relinked");
+	cr_expect(idlist_prev(&item3.link) == &item1.link, "neighbours should be relinked");
+
+	cr_expect(idlist_remove(&list, &item3.link) == 0, "remove at tail should return 0");
+	cr_expect(idlist_tail(&list) == &item1.link, "tail should move back");
+
+	cr_expect(idlist_remove(&list, &item1.link) == 0, "remove at head should return 0");
+	cr_expect(idlist_size(&list) == 0, "list's size should be 0");
+	cr_expect(idlist_head(&list) == NULL && idlist_tail(&list) == NULL, "list should be empty");
+}
@@ -0,0 +1,82 @@
+/**
+ * \file ilist_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for intrusive List ADT
+ */
+#include <criterion/criterion.h>
+
+#include "../src/ilist.h"
+
+typedef struct Item_s {
+	int value;
+	IList_Link link;
+
+} Item;
+
+IList list;
+
+Item item1 = { 1 };
+Item item2 = { 2 };
+Item item3 = { 3 };
+
+void
+suite_setup()
+{
+	ilist_init(&list);
+}
+
+TestSuite(ilist_tests, .init=suite_setup);
+
+Test(ilist_tests, empty)
+{
+	IList_Link *removed;
+
+	cr_expect(ilist_size(&list) == 0, "empty list's size should be 0");
+	cr_expect(ilist_head(&list) == NULL, "empty list's head should be NULL");
+	cr_expect(ilist_tail(&list) == NULL, "empty list's tail should be NULL");
+	cr_expect(ilist_remove_next(&list, NULL, &removed) == -1, "remove from empty list should return -1");
+}
+
+Test(ilist_tests, entry)
+{
+	cr_expect(ilist_entry(&item2.link, Item, link) == &item2, "entry should recover the object");
+}
+
+Test(ilist_tests, insert)
+{
+	cr_expect(ilist_insert_next(&list, NULL, &item1.link) == 0, "insert into empty list should return 0");
+	cr_expect(ilist_insert_next(&list, ilist_tail(&list), &item3.link) == 0, "insert at tail should return 0");
+	cr_expect(ilist_insert_next(&list, ilist_head(&list), &item2.link) == 0, "insert after head should return 0");
+	cr_expect(ilist_size(&list) == 3, "list's size should be 3");
+	// h              t
+	// [1]->[2]->[3]->0
+
+	cr_expect(ilist_entry(ilist_head(&list), Item, link)->value == 1, "head should be item 1");
+	cr_expect(ilist_entry(ilist_next(ilist_head(&list)), Item, link)->value == 2, "second should be item 2");
+	cr_expect(ilist_entry(ilist_tail(&list), Item, link)->value == 3, "tail should be item 3");
+	cr_expect(ilist_is_tail(ilist_tail(&list)) == 1, "tail should be at the tail of the list");
+}
+
+Test(ilist_tests, remove)
+{
+	IList_Link *removed;
+
+	ilist_insert_next(&list, NULL, &item1.link);
+	ilist_insert_next(&list, NULL, &item2.link);
+	ilist_insert_next(&list, NULL, &item3.link);
+	// h              t
+	// [3]->[2]->[1]->0
+
+	cr_expect(ilist_remove_next(&list, ilist_head(&list), &removed) == 0, "remove after head should return 0");
+	cr_expect(removed == &item2.link, "removed link should be item 2's");
+	cr_expect(ilist_size(&list) == 2, "list's size should be 2");
+
+	cr_expect(ilist_remove_next(&list, ilist_head(&list), &removed) == 0, "remove after head should return 0");
+	cr_expect(removed == &item1.link, "removed link should be item 1's");
+	cr_expect(ilist_tail(&list) == &item3.link, "tail should move back to the head");
+	cr_expect(ilist_remove_next(&list, ilist_head(&list), &removed) == -1, "remove after tail should return -1");
+
+	cr_expect(ilist_remove_next(&list, NULL, &removed) == 0, "remove at head should return 0");
+	cr_expect(removed == &item3.link, "removed link should be item 3's");
+	cr_expect(ilist_head(&list) == NULL && ilist_tail(&list) == NULL, "list should be empty");
+}
@@ -0,0 +1,169 @@
+/**
+ * \file inline_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for inline value storage in List, DList, CList, Stack and Queue
+ */
+#include <criterion/criterion.h>
+
+#include "../src/clist.h"
+#include "../src/dlist.h"
+#include "../src/list.h"
+#include "../src/queue.h"
+#include "../src/stack.h"
+
+typedef struct Record_s {
+	long id;
+	double value;
+
+} Record;
+
+static int destroyed;
+
+static void
+count_destroy(void *data)
+{
+	destroyed++;
+}
+
+void
+suite_setup()
+{
+	destroyed = 0;
+}
+
+TestSuite(inline_tests, .init=suite_setup);
+
+Test(inline_tests, list_copies_values)
+{
+	List list;
+	Record record = { 1, 1.5 };
+	Record out = { 0, 0.0 };
+	void *removed = &out;
+
+	list_init_inline(&list, count_destroy, sizeof (Record), NULL);
+
+	cr_expect(list_insert_next(&list, NULL, &record) == 0, "insert into empty list should return 0");
+	record.id = 2;
+	cr_expect(list_insert_next(&list, list_tail(&list), &record) == 0, "insert at tail should return 0");
+
+	// Values were copied, so changing the source afterwards does not affect them
+	record.id = 3;
+	cr_expect(((Record *)list_data(list_head(&list)))->id == 1, "head should hold a copy of the first value");
+	cr_expect(((Record *)list_data(list_tail(&list)))->id == 2, "tail should hold a copy of the second value");
+	cr_expect(list_data(list_head(&list)) == (void *)list_head(&list)->value, "data should point inline");
+
+	cr_expect(list_remove_next(&list, NULL, &removed) == 0, "remove at head should return 0");
+	cr_expect(removed == &out, "data should still point to the caller's buffer");
+	cr_expect(out.id == 1 && out.value == 1.5, "value should be copied out");
+
+	list_destroy(&list);
+	cr_expect(destroyed == 1, "destroy should be called for the remaining value");
+}
+
+Test(inline_tests, list_drop_value)
+{
+	List list;
+	int value = 7;
+	void *removed = NULL;
+
+	list_init_inline(&list, NULL, sizeof (int), NULL);
+	list_insert_next(&list, NULL, &value);
+
+	cr_expect(list_remove_next(&list, NULL, &removed) == 0, "remove with NULL buffer should return 0");
+	cr_expect(removed == NULL, "dropped value should leave data NULL");
+	cr_expect(list_size(&list) == 0, "list's size should be 0");
+
+	list_destroy(&list);
+}
+
+Test(inline_tests, dlist_copies_values)
+{
+	DList list;
+	int values[3] = { 1, 2, 3 };
+	int out = 0;
+	void *removed = &out;
+
+	dlist_init_inline(&list, count_destroy, sizeof (int), NULL);
+
+	cr_expect(dlist_insert_next(&list, NULL, &values[1]) == 0, "insert into empty list should return 0");
+	cr_expect(dlist_insert_prev(&list, dlist_head(&list), &values[0]) == 0, "insert before head should return 0");
+	cr_expect(dlist_insert_next(&list, dlist_tail(&list), &values[2]) == 0, "insert after tail should return 0");
+
+	cr_expect(*(int *)dlist_data(dlist_head(&list)) == 1, "head should hold 1");
+	cr_expect(*(int *)dlist_data(dlist_next(dlist_head(&list))) == 2, "second should hold 2");
+	cr_expect(*(int *)dlist_data(dlist_tail(&list)) == 3, "tail should hold 3");
+
+	cr_expect(dlist_remove(&list, dlist_next(dlist_head(&list)), &removed) == 0, "remove should return 0");
+	cr_expect(out == 2, "value should be copied out");
+
+	dlist_destroy(&list);
+	cr_expect(destroyed == 2, "destroy should be called for each remaining value");
+}
+
+Test(inline_tests, clist_copies_values)
+{
+	CList list;
+	int values[2] = { 1, 2 };
+	int out = 0;
+	void *removed = &out;
+
+	clist_init_inline(&list, count_destroy, sizeof (int), NULL);
+
+	cr_expect(clist_insert_next(&list, NULL, &values[0]) == 0, "insert into empty list should return 0");
+	cr_expect(clist_insert_next(&list, clist_head(&list), &values[1]) == 0, "insert after head should return 0");
+	cr_expect(*(int *)clist_data(clist_next(clist_head(&list))) == 2, "second should hold 2");
+
+	cr_expect(clist_remove_next(&list, clist_head(&list), &removed) == 0, "remove should return 0");
+	cr_expect(out == 2, "value should be copied out");
+
+	clist_destroy(&list);
+	cr_expect(destroyed == 1, "destroy should be called for the remaining value");
+}
+
+Test(inline_tests, stack_and_queue)
+{
+	Stack stack;
+	Queue queue;
+	int i, out;
+	void *removed = &out;
+
+	stack_init_inline(&stack, NULL, sizeof (int), NULL);
+	queue_init_inline(&queue, NULL, sizeof (int), &node_cache_allocator);
+
+	for (i = 0; i < 3; i++) {
+		cr_expect(stack_push(&stack, &i) == 0, "push should return 0");
+		cr_expect(queue_enqueue(&queue, &i) == 0, "enqueue should return 0");
+	}
+
+	cr_expect(*(int *)stack_peek(&stack) == 2, "top of stack should be last value pushed");
+	cr_expect(*(int *)queue_peek(&queue) == 0, "front of queue should be first value enqueued");
+
+	for (i = 0; i < 3; i++) {
+		cr_expect(stack_pop(&stack, &removed) == 0 && out == 2 - i, "pop should copy values in LIFO order");
+		cr_expect(queue_dequeue(&queue, &removed) == 0 && out == i, "dequeue should copy values in FIFO order");
+	}
+
+	stack_destroy(&stack);
+	queue_destroy(&queue);
+}
+
+Test(inline_tests, queue_batch)
+{
+	Queue queue;
+	int values[3] = { 1, 2, 3 };
+	int out[2] = { 0, 0 };
+	void *batch[3] = { &values[0], &values[1], &values[2] };
+	void *removed[3] = { &out[0], NULL, &out[1] };
+
+	queue_init_inline(&queue, NULL, sizeof (int), NULL);
+
+	cr_expect(queue_enqueue_n(&queue, batch, 3) == 0, "batch enqueue should return 0");
+	values[0] = 0;
+	cr_expect(*(int *)queue_peek(&queue) == 1, "front of queue should hold a copy of the first value");
+
+	cr_expect(queue_dequeue_n(&queue, removed, 3) == 3, "batch dequeue should return 3");
+	cr_expect(out[0] == 1 && out[1] == 3, "values should be copied out, skipping the NULL buffer");
+	cr_expect(removed[1] == NULL, "dropped value should leave data NULL");
+
+	queue_destroy(&queue);
+}
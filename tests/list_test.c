@@ -41,6 +41,18 @@ int *item3 = NULL;
 // 	}
 // }
 
+typedef struct Record_s {
+	int key;
+	int order;
+
+} Record;
+
+static int
+compare_records(const void *key1, const void *key2)
+{
+	return ((const Record *)key1)->key - ((const Record *)key2)->key;
+}
+
 void
 suite_setup()
 {
@@ -255,3 +267,232 @@ Test(list_tests, remove_in_between)
 	cr_expect(removed == item2, "removed item should point to the second item inserted");
 	cr_expect(list_data(list_tail(&list)) == item1, "tail should be the first item inserted");
 }
+
+Test(list_tests, insert_remove_n)
+{
+	void *batch[2] = { item2, item3 };
+	void *removed[3] = { NULL, NULL, NULL };
+
+	cr_expect(list_insert_next(&list, NULL, item1) == 0, "insert into empty list should return 0");
+	cr_expect(list_insert_next_n(&list, list_head(&list), batch, 2) == 0, "batch insert should return 0");
+	cr_expect(list_size(&list) == 3, "list's size should be 3");
+	// h              t
+	// [1]->[2]->[3]->0
+
+	cr_expect(list_data(list_next(list_head(&list))) == item2, "batch should follow the head in order");
+	cr_expect(list_data(list_tail(&list)) == item3, "tail should be the last item of the batch");
+
+	cr_expect(list_remove_next_n(&list, list_head(&list), removed, 3) == 2, "batch remove should stop at tail");
+	cr_expect(list_size(&list) == 1, "list's size should be 1");
+	// h t
+	// [1]->0, removed=[2],[3]
+
+	cr_expect(removed[0] == item2 && removed[1] == item3, "removed items should be in list order");
+	cr_expect(list_tail(&list) == list_head(&list), "tail should be back at the head");
+	cr_expect(list_remove_next_n(&list, list_tail(&list), removed, 1) == 0, "remove past tail should return 0");
+
+	free(item2);
+	free(item3);
+}
+
+Test(list_tests, sort)
+{
+	List sorted;
+	Record records[100];
+	List_Element *element;
+	Record *previous = NULL, *current;
+	int i;
+
+	list_init(&sorted, NULL);
+
+	// Sorting an empty list is a no-op
+	list_sort(&sorted, compare_records);
+	cr_expect(list_head(&sorted) == NULL && list_tail(&sorted) == NULL, "empty list should stay empty");
+
+	// Few distinct keys, so stability is exercised
+	for (i = 0; i < 100; i++) {
+		records[i].key = (i * 37) % 10;
+		records[i].order = i;
+		list_insert_next(&sorted, list_tail(&sorted), &records[i]);
+	}
+
+	list_sort(&sorted, compare_records);
+	cr_expect(list_size(&sorted) == 100, "list's size should be unchanged");
+
+	for (i = 0, element = list_head(&sorted); element != NULL; i++, element = list_next(element)) {
+		current = (Record *)list_data(element);
+
+		if (previous != NULL) {
+			cr_expect(previous->key <= current->key, "keys should be in ascending order");
+			cr_expect(previous->key < current->key || previous->order < current->order,
+			          "equal keys should keep their insertion order");
+		}
+
+		cr_expect(list_is_tail(element) == (element == list_tail(&sorted)), "tail should be the last element");
+		previous = current;
+	}
+
+	cr_expect(i == 100, "every element should still be linked");
+
+	list_destroy(&sorted);
+}
+
+// Build a linked-list holding pointers to `values[0]` .. `values[count - 1]`
+static void
+fill_list(List *target, int *values, int count)
+{
+	int i;
+
+	list_init(target, NULL);
+
+	for (i = 0; i < count; i++) {
+		list_insert_next(target, list_tail(target), &values[i]);
+	}
+}
+
+// Determine whether a linked-list holds exactly `expected[0]` .. `expected[count - 1]` in order
+static int
+holds(List *target, int *const *expected, int count)
+{
+	List_Element *element = list_head(target);
+	int i;
+
+	if (list_size(target) != count) {
+		return 0;
+	}
+
+	for (i = 0; i < count; i++, element = list_next(element)) {
+		if (list_data(element) != expected[i]) {
+			return 0;
+		}
+	}
+
+	if (count > 0 && list_data(list_tail(target)) != expected[count - 1]) {
+		return 0;
+	}
+
+	return 1;
+}
+
+Test(list_tests, splice_concat_split)
+{
+	List first, second, rest, pooled;
+	int a[3] = { 1, 2, 3 }, b[2] = { 4, 5 };
+	int *spliced[5] = { &a[0], &b[0], &b[1], &a[1], &a[2] };
+	int *joined[7] = { &a[0], &b[0], &b[1], &a[1], &a[2], &b[0], &b[1] };
+	List_Element *element;
+	int i;
+
+	fill_list(&first, a, 3);
+	fill_list(&second, b, 2);
+
+	// Splice into the middle
+	cr_expect(list_splice(&first, list_head(&first), &second) == 0, "splice should return 0");
+	cr_expect(holds(&first, spliced, 5), "spliced elements should follow the given element");
+	cr_expect(list_size(&second) == 0 && list_head(&second) == NULL, "spliced list should be empty");
+	cr_expect(list_splice(&first, list_head(&first), &first) == -1, "splice into itself should fail");
+
+	// Concatenate onto the end
+	fill_list(&second, b, 2);
+	cr_expect(list_concat(&first, &second) == 0, "concat should return 0");
+	cr_expect(holds(&first, joined, 7), "concatenated elements should follow the last element");
+
+	// Split the concatenated elements back off
+	for (i = 0, element = list_head(&first); i < 4; i++) {
+		element = list_next(element);
+	}
+
+	list_init(&rest, NULL);
+	cr_expect(list_split(&first, element, &rest) == 0, "split should return 0");
+	cr_expect(holds(&first, spliced, 5), "split list should keep the elements up to the split");
+	cr_expect(holds(&rest, &joined[5], 2), "other list should receive the rest");
+	cr_expect(list_split(&first, NULL, &rest) == -1, "split into non-empty list should fail");
+
+	// Concatenating onto an empty list takes the other list over
+	cr_expect(list_concat(&second, &rest) == 0, "concat onto empty list should return 0");
+	cr_expect(holds(&second, &joined[5], 2), "empty list should take over the elements");
+
+	// Lists with different storage cannot trade elements
+	cr_expect(list_init_arena(&pooled, NULL, 0) == 0, "arena list init should return 0");
+	cr_expect(list_concat(&pooled, &second) == -1, "concat across allocators should fail");
+	cr_expect(list_size(&second) == 2, "failed concat should leave the other list alone");
+
+	// Arena lists cannot trade elements even through a shared arena, which each would release
+	list_insert_next(&pooled, NULL, &a[0]);
+	rest.allocator = pooled.allocator;
+	cr_expect(list_splice(&pooled, NULL, &rest) == -1, "splice between arena lists should fail");
+	cr_expect(list_split(&pooled, NULL, &rest) == -1, "split between arena lists should fail");
+	cr_expect(list_size(&pooled) == 1 && list_size(&rest) == 0, "failed split should leave both lists alone");
+	rest.allocator = allocator_default;
+
+	list_destroy(&pooled);
+	list_destroy(&rest);
+	list_destroy(&second);
+	list_destroy(&first);
+}
+
+static int destroyed;
+
+static void
+count_destroy(void *data)
+{
+	destroyed++;
+}
+
+static int
+match_int(const void *key, const void *data)
+{
+	return *(const int *)key == *(const int *)data;
+}
+
+Test(list_tests, find_count_remove_matching)
+{
+	List searched;
+	int values[6] = { 7, 1, 7, 2, 7, 3 };
+	int *remaining[3] = { &values[1], &values[3], &values[5] };
+	int key = 7, missing = 4;
+	List_Element *found;
+	int i;
+
+	fill_list(&searched, values, 6);
+	searched.destroy = count_destroy;
+	destroyed = 0;
+
+	cr_expect(searched.match == NULL, "init should clear the match function");
+	cr_expect(list_find(&searched, &key) == NULL, "find without a match function should return NULL");
+	cr_expect(list_count(&searched, &key) == -1, "count without a match function should return -1");
+	cr_expect(list_remove_matching(&searched, &key) == -1, "remove without a match function should return -1");
+
+	list_set_match(&searched, match_int);
+
+	// Walk the matches with find/find_next
+	found = list_find(&searched, &key);
+	cr_expect(found != NULL && list_data(found) == &values[0], "find should return the first match");
+
+	for (i = 2; i <= 4; i += 2) {
+		found = list_find_next(&searched, found, &key);
+		cr_expect(found != NULL && list_data(found) == &values[i], "find_next should return the next match");
+	}
+
+	cr_expect(list_find_next(&searched, found, &key) == NULL, "find_next past the last match should return NULL");
+	cr_expect(list_find(&searched, &missing) == NULL, "find of a missing key should return NULL");
+
+	cr_expect(list_count(&searched, &key) == 3, "count should return the number of matches");
+	cr_expect(list_count(&searched, &missing) == 0, "count of a missing key should return 0");
+
+	// Removing the matches leaves the others in order
+	cr_expect(list_remove_matching(&searched, &key) == 3, "remove should return the number removed");
+	cr_expect(destroyed == 3, "destroy should be called for each removed element");
+	cr_expect(holds(&searched, remaining, 3), "remaining elements should keep their order");
+
+	// Removing every element empties the list
+	key = 1;
+	list_remove_matching(&searched, &key);
+	key = 2;
+	list_remove_matching(&searched, &key);
+	key = 3;
+	cr_expect(list_remove_matching(&searched, &key) == 1, "remove of the last element should return 1");
+	cr_expect(list_size(&searched) == 0 && list_head(&searched) == NULL, "list should be empty");
+
+	list_destroy(&searched);
+}
@@ -0,0 +1,256 @@
+/**
+ * \file mpmcqueue_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for multi-producer/multi-consumer Queue
+ */
+#include <criterion/criterion.h>
+
+#include <pthread.h>
+#include <sched.h>  // sched_yield()
+#include <stdlib.h> // free()
+
+#include "../src/mpmcqueue.h"
+
+#define THREAD_COUNT 4
+#define TRANSFER_COUNT 200000L
+
+MPMCQueue queue;
+
+int items[4] = { 1, 2, 3, 4 };
+
+void
+suite_setup()
+{
+	mpmcqueue_init(&queue, NULL, 4);
+}
+
+void
+suite_teardown()
+{
+	mpmcqueue_destroy(&queue);
+}
+
+TestSuite(mpmcqueue_tests, .init=suite_setup, .fini=suite_teardown);
+
+Test(mpmcqueue_tests, empty)
+{
+	void *dequeued;
+	MPMCQueue small;
+
+	cr_expect(mpmcqueue_capacity(&queue) == 4, "capacity should be 4");
+	cr_expect(mpmcqueue_size(&queue) == 0, "empty queue's size should be 0");
+	cr_expect(mpmcqueue_try_dequeue(&queue, &dequeued) == -1, "dequeue from empty queue should return -1");
+
+	mpmcqueue_init(&small, NULL, 1);
+	cr_expect(mpmcqueue_capacity(&small) == 2, "capacity should be at least 2");
+	mpmcqueue_destroy(&small);
+}
+
+Test(mpmcqueue_tests, fill_and_drain)
+{
+	void *dequeued;
+	int round, i;
+
+	// Several rounds so the positions lap the ring
+	for (round = 0; round < 3; round++) {
+		for (i = 0; i < 4; i++) {
+			cr_expect(mpmcqueue_try_enqueue(&queue, &items[i]) == 0, "enqueue should return 0");
+		}
+
+		cr_expect(mpmcqueue_try_enqueue(&queue, &items[0]) == -1, "enqueue onto full queue should return -1");
+		cr_expect(mpmcqueue_size(&queue) == 4, "queue's size should be 4");
+
+		for (i = 0; i < 4; i++) {
+			mpmcqueue_dequeue(&queue, &dequeued);
+			cr_expect(dequeued == &items[i], "dequeue should return items in order");
+		}
+
+		cr_expect(mpmcqueue_try_dequeue(&queue, &dequeued) == -1, "dequeue from drained queue should return -1");
+	}
+}
+
+static void *
+producer_run(void *arg)
+{
+	long base = (long)arg * TRANSFER_COUNT;
+	long i;
+
+	for (i = 1; i <= TRANSFER_COUNT; i++) {
+		mpmcqueue_enqueue(&queue, (void *)(base + i));
+	}
+
+	return NULL;
+}
+
+static void *
+consumer_run(void *arg)
+{
+	long *last = (long *)arg;
+	void *dequeued;
+	long i, value, producer;
+
+	// Values from each producer must come out in the order that producer put them in
+	for (i = 0; i < TRANSFER_COUNT; i++) {
+		mpmcqueue_dequeue(&queue, &dequeued);
+		value = (long)dequeued;
+		producer = (value - 1) / TRANSFER_COUNT;
+
+		if (value <= last[producer]) {
+			last[THREAD_COUNT] = 1;
+		}
+
+		last[producer] = value;
+		last[THREAD_COUNT + 1] += value;
+	}
+
+	return NULL;
+}
+
+Test(mpmcqueue_tests, many_threads)
+{
+	pthread_t producers[THREAD_COUNT], consumers[THREAD_COUNT];
+	// Per consumer: last value seen from each producer, then a disorder flag and a running sum
+	long last[THREAD_COUNT][THREAD_COUNT + 2] = { { 0 } };
+	long sum = 0, n = THREAD_COUNT * TRANSFER_COUNT;
+	int disorder = 0;
+	long i;
+
+	for (i = 0; i < THREAD_COUNT; i++) {
+		pthread_create(&consumers[i], NULL, consumer_run, last[i]);
+		pthread_create(&producers[i], NULL, producer_run, (void *)i);
+	}
+
+	for (i = 0; i < THREAD_COUNT; i++) {
+		pthread_join(producers[i], NULL);
+		pthread_join(consumers[i], NULL);
+		sum += last[i][THREAD_COUNT + 1];
+		disorder |= last[i][THREAD_COUNT];
+	}
+
+	cr_expect(sum == n * (n + 1) / 2, "every item should be dequeued exactly once");
+	cr_expect(disorder == 0, "items from one producer should be dequeued in order");
+	cr_expect(mpmcqueue_size(&queue) == 0, "queue should be empty");
+}
+
+Test(mpmcqueue_tests, destroy_data)
+{
+	MPMCQueue owned;
+	int i;
+
+	mpmcqueue_init(&owned, free, 8);
+
+	for (i = 0; i < 3; i++) {
+		mpmcqueue_try_enqueue(&owned, malloc(sizeof (int)));
+	}
+
+	mpmcqueue_destroy(&owned);
+	cr_expect(owned.slots == NULL, "destroyed queue should be cleared");
+}
+
+Test(mpmcqueue_tests, batch)
+{
+	void *batch[4] = { &items[0], &items[1], &items[2], &items[3] };
+	void *dequeued[4];
+	int round, i;
+
+	// Several rounds so the batches wrap around the end of the ring
+	for (round = 0; round < 3; round++) {
+		cr_expect(mpmcqueue_try_enqueue(&queue, batch[0]) == 0, "enqueue should return 0");
+		cr_expect(mpmcqueue_try_enqueue_n(&queue, &batch[1], 4) == 3, "batch enqueue should stop when full");
+		cr_expect(mpmcqueue_try_enqueue_n(&queue, batch, 1) == 0, "batch enqueue onto full queue should return 0");
+
+		cr_expect(mpmcqueue_try_dequeue_n(&queue, dequeued, 3) == 3, "batch dequeue should return 3");
+		cr_expect(mpmcqueue_try_dequeue_n(&queue, &dequeued[3], 4) == 1, "batch dequeue should stop when empty");
+
+		for (i = 0; i < 4; i++) {
+			cr_expect(dequeued[i] == batch[i], "dequeued items should be in order");
+		}
+	}
+}
+
+#define BATCH_COUNT 8
+
+static void *
+batch_producer_run(void *arg)
+{
+	long base = (long)arg * TRANSFER_COUNT;
+	void *batch[BATCH_COUNT];
+	long i, next = 1;
+	int n;
+
+	while (next <= TRANSFER_COUNT) {
+		for (n = 0; n < BATCH_COUNT && next + n <= TRANSFER_COUNT; n++) {
+			batch[n] = (void *)(base + next + n);
+		}
+
+		// Whatever did not fit is retried in the next batch
+		for (i = mpmcqueue_try_enqueue_n(&queue, batch, n); i == 0; ) {
+			sched_yield();
+			i = mpmcqueue_try_enqueue_n(&queue, batch, n);
+		}
+
+		next += i;
+	}
+
+	return NULL;
+}
+
+static void *
+batch_consumer_run(void *arg)
+{
+	long *last = (long *)arg;
+	void *dequeued[BATCH_COUNT];
+	long i = 0, value, producer;
+	int n, j;
+
+	while (i < TRANSFER_COUNT) {
+		n = TRANSFER_COUNT - i < BATCH_COUNT ? (int)(TRANSFER_COUNT - i) : BATCH_COUNT;
+
+		if ((n = mpmcqueue_try_dequeue_n(&queue, dequeued, n)) == 0) {
+			sched_yield();
+			continue;
+		}
+
+		for (j = 0; j < n; j++) {
+			value = (long)dequeued[j];
+			producer = (value - 1) / TRANSFER_COUNT;
+
+			if (value <= last[producer]) {
+				last[THREAD_COUNT] = 1;
+			}
+
+			last[producer] = value;
+			last[THREAD_COUNT + 1] += value;
+		}
+
+		i += n;
+	}
+
+	return NULL;
+}
+
+Test(mpmcqueue_tests, many_threads_batch)
+{
+	pthread_t producers[THREAD_COUNT], consumers[THREAD_COUNT];
+	// Same layout as in many_threads
+	long last[THREAD_COUNT][THREAD_COUNT + 2] = { { 0 } };
+	long sum = 0, n = THREAD_COUNT * TRANSFER_COUNT;
+	int disorder = 0;
+	long i;
+
+	for (i = 0; i < THREAD_COUNT; i++) {
+		pthread_create(&consumers[i], NULL, batch_consumer_run, last[i]);
+		pthread_create(&producers[i], NULL, batch_producer_run, (void *)i);
+	}
+
+	for (i = 0; i < THREAD_COUNT; i++) {
+		pthread_join(producers[i], NULL);
+		pthread_join(consumers[i], NULL);
+		sum += last[i][THREAD_COUNT + 1];
+		disorder |= last[i][THREAD_COUNT];
+	}
+
+	cr_expect(sum == n * (n + 1) / 2, "every item should be dequeued exactly once");
+	cr_expect(disorder == 0, "items from one producer should be dequeued in order");
+	cr_expect(mpmcqueue_size(&queue) == 0, "queue should be empty");
+}
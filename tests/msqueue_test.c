@@ -0,0 +1,162 @@
+/**
+ * \file msqueue_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for unbounded concurrent Queue
+ */
+#include <criterion/criterion.h>
+
+#include <pthread.h>
+#include <sched.h>  // sched_yield()
+#include <stdlib.h> // free()
+
+#include "../src/msqueue.h"
+
+#define THREAD_COUNT 4
+#define TRANSFER_COUNT 200000L
+
+MSQueue queue;
+
+int items[3] = { 1, 2, 3 };
+
+void
+suite_setup()
+{
+	msqueue_init(&queue, NULL);
+}
+
+void
+suite_teardown()
+{
+	msqueue_destroy(&queue);
+}
+
+TestSuite(msqueue_tests, .init=suite_setup, .fini=suite_teardown);
+
+Test(msqueue_tests, empty)
+{
+	void *dequeued;
+
+	cr_expect(msqueue_dequeue(&queue, &dequeued) == -1, "dequeue from empty queue should return -1");
+}
+
+Test(msqueue_tests, enqueue_dequeue)
+{
+	void *dequeued;
+	int round, i;
+
+	for (round = 0; round < 2; round++) {
+		for (i = 0; i < 3; i++) {
+			cr_expect(msqueue_enqueue(&queue, &items[i]) == 0, "enqueue should return 0");
+		}
+
+		for (i = 0; i < 3; i++) {
+			cr_expect(msqueue_dequeue(&queue, &dequeued) == 0, "dequeue should return 0");
+			cr_expect(dequeued == &items[i], "dequeue should return items in order");
+		}
+
+		cr_expect(msqueue_dequeue(&queue, &dequeued) == -1, "dequeue from drained queue should return -1");
+	}
+}
+
+static void *
+producer_run(void *arg)
+{
+	long base = (long)arg * TRANSFER_COUNT;
+	long i;
+
+	for (i = 1; i <= TRANSFER_COUNT; i++) {
+		msqueue_enqueue(&queue, (void *)(base + i));
+	}
+
+	return NULL;
+}
+
+static void *
+consumer_run(void *arg)
+{
+	long *last = (long *)arg;
+	void *dequeued;
+	long i, value, producer;
+
+	// Values from each producer must come out in the order that producer put them in
+	for (i = 0; i < TRANSFER_COUNT; i++) {
+		while (msqueue_dequeue(&queue, &dequeued) != 0) {
+			sched_yield();
+		}
+
+		value = (long)dequeued;
+		producer = (value - 1) / TRANSFER_COUNT;
+
+		if (value <= last[producer]) {
+			last[THREAD_COUNT] = 1;
+		}
+
+		last[producer] = value;
+		last[THREAD_COUNT + 1] += value;
+	}
+
+	return NULL;
+}
+
+Test(msqueue_tests, many_threads)
+{
+	pthread_t producers[THREAD_COUNT], consumers[THREAD_COUNT];
+	// Per consumer: last value seen from each producer, then a disorder flag and a running sum
+	long last[THREAD_COUNT][THREAD_COUNT + 2] = { { 0 } };
+	long sum = 0, n = THREAD_COUNT * TRANSFER_COUNT;
+	void *dequeued;
+	int disorder = 0;
+	long i;
+
+	for (i = 0; i < THREAD_COUNT; i++) {
+		pthread_create(&consumers[i], NULL, consumer_run, last[i]);
+		pthread_create(&producers[i], NULL, producer_run, (void *)i);
+	}
+
+	for (i = 0; i < THREAD_COUNT; i++) {
+		pthread_join(producers[i], NULL);
+		pthread_join(consumers[i], NULL);
+		sum += last[i][THREAD_COUNT + 1];
+		disorder |= last[i][THREAD_COUNT];
+	}
+
+	cr_expect(sum == n * (n + 1) / 2, "every item should be dequeued exactly once");
+	cr_expect(disorder == 0, "items from one producer should be dequeued in order");
+	cr_expect(msqueue_dequeue(&queue, &dequeued) == -1, "queue should be empty");
+}
+
+Test(msqueue_tests, destroy_data)
+{
+	MSQueue owned;
+	int i;
+
+	cr_expect(msqueue_init(&owned, free) == 0, "init should return 0");
+
+	for (i = 0; i < 3; i++) {
+		msqueue_enqueue(&owned, malloc(sizeof (int)));
+	}
+
+	msqueue_destroy(&owned);
+	cr_expect(atomic_load(&owned.head) == NULL, "destroyed queue should be cleared");
+}
+
+Test(msqueue_tests, batch)
+{
+	void *batch[3] = { &items[0], &items[1], &items[2] };
+	void *dequeued[4];
+	int i;
+
+	cr_expect(msqueue_enqueue(&queue, &items[0]) == 0, "enqueue should return 0");
+	cr_expect(msqueue_enqueue_n(&queue, batch, 3) == 0, "batch enqueue should return 0");
+	cr_expect(msqueue_enqueue(&queue, &items[1]) == 0, "enqueue after batch should return 0");
+
+	cr_expect(msqueue_dequeue_n(&queue, dequeued, 4) == 4, "batch dequeue should return 4");
+	cr_expect(dequeued[0] == &items[0], "dequeue should return items in order");
+
+	for (i = 0; i < 3; i++) {
+		cr_expect(dequeued[i + 1] == batch[i], "batch should be dequeued in order");
+	}
+
+	cr_expect(msqueue_dequeue_n(&queue, dequeued, 4) == 1, "batch dequeue should stop when empty");
+	cr_expect(dequeued[0] == &items[1], "element enqueued after batch should follow it");
+}
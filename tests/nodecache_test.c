@@ -0,0 +1,90 @@
+/**
+ * \file nodecache_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for the per-thread node cache
+ */
+#include <criterion/criterion.h>
+
+#include "../src/nodecache.h"
+#include "../src/stack.h"
+
+Stack stack;
+
+void
+suite_setup()
+{
+	node_cache_flush();
+	stack_init_cached(&stack, NULL);
+}
+
+void
+suite_teardown()
+{
+	stack_destroy(&stack);
+	node_cache_flush();
+}
+
+TestSuite(nodecache_tests, .init=suite_setup, .fini=suite_teardown);
+
+Test(nodecache_tests, defaults)
+{
+	Node_Cache_Stats stats;
+
+	node_cache_stats(&stats);
+	cr_expect(stats.count == 0, "flushed cache should be empty");
+	cr_expect(stats.low == NODE_CACHE_DEFAULT_LOW, "low watermark should default");
+	cr_expect(stats.high == NODE_CACHE_DEFAULT_HIGH, "high watermark should default");
+}
+
+Test(nodecache_tests, watermarks)
+{
+	cr_expect(node_cache_set_watermarks(8, 4) == -1, "low above high should return -1");
+	cr_expect(node_cache_set_watermarks(0, 0) == -1, "zero high watermark should return -1");
+	cr_expect(node_cache_set_watermarks(2, 4) == 0, "valid watermarks should return 0");
+}
+
+Test(nodecache_tests, push_pop_hits)
+{
+	Node_Cache_Stats stats;
+	void *removed;
+	int item = 1;
+	int i;
+
+	// The first push misses, after which every pair recycles the same element
+	for (i = 0; i < 100; i++) {
+		cr_expect(stack_push(&stack, &item) == 0, "push should return 0");
+		cr_expect(stack_pop(&stack, &removed) == 0, "pop should return 0");
+	}
+
+	node_cache_stats(&stats);
+	cr_expect(stats.misses == 1, "only the first push should miss");
+	cr_expect(stats.hits == 99, "later pushes should hit");
+	cr_expect(stats.count == 1, "popped element should stay cached");
+}
+
+Test(nodecache_tests, trim_at_high_watermark)
+{
+	Node_Cache_Stats stats;
+	void *removed;
+	int item = 1;
+	int i;
+
+	cr_expect(node_cache_set_watermarks(2, 4) == 0, "valid watermarks should return 0");
+
+	for (i = 0; i < 6; i++) {
+		cr_expect(stack_push(&stack, &item) == 0, "push should return 0");
+	}
+
+	for (i = 0; i < 6; i++) {
+		cr_expect(stack_pop(&stack, &removed) == 0, "pop should return 0");
+	}
+
+	// Four pops fill the cache, the fifth trims it to two, and the sixth tops it back up
+	node_cache_stats(&stats);
+	cr_expect(stats.trims == 2, "cache should trim down to the low watermark");
+	cr_expect(stats.count == 4, "cache should hold the blocks freed after the trim");
+
+	node_cache_flush();
+	node_cache_stats(&stats);
+	cr_expect(stats.count == 0, "flush should empty the cache");
+}
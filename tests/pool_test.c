@@ -0,0 +1,234 @@
+/**
+ * \file pool_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for Pool, pooled List elements and arena-backed lists
+ */
+#include <criterion/criterion.h>
+
+#include <string.h> // memset()
+
+#include "../src/pool.h"
+#include "../src/clist.h"
+#include "../src/dlist.h"
+#include "../src/list.h"
+#include "../src/queue.h"
+#include "../src/stack.h"
+
+Pool pool;
+
+void
+suite_setup()
+{
+	pool_init(&pool, sizeof (List_Element), 4);
+}
+
+void
+suite_teardown()
+{
+	pool_destroy(&pool);
+}
+
+TestSuite(pool_tests, .init=suite_setup, .fini=suite_teardown);
+
+Test(pool_tests, empty)
+{
+	cr_expect(pool.slabs == NULL, "new pool should not own any slabs");
+	cr_expect(pool.free_list == NULL, "new pool's free list should be empty");
+	cr_expect(pool.object_size >= sizeof (List_Element), "object size should fit a list element");
+}
+
+Test(pool_tests, alloc_carves_from_slab)
+{
+	void *a = pool_alloc(&pool);
+	void *b = pool_alloc(&pool);
+
+	cr_expect(a != NULL && b != NULL, "alloc from pool should succeed");
+	cr_expect((char *)b - (char *)a == (long)pool.object_size, "objects should be adjacent in a slab");
+	cr_expect(pool.slabs != NULL && pool.slabs->next == NULL, "pool should own one slab");
+}
+
+Test(pool_tests, alloc_grows_slabs)
+{
+	int i;
+
+	for (i = 0; i < 5; i++) {
+		cr_expect(pool_alloc(&pool) != NULL, "alloc from pool should succeed");
+	}
+
+	cr_expect(pool.slabs != NULL && pool.slabs->next != NULL, "pool should own two slabs");
+}
+
+Test(pool_tests, free_recycles)
+{
+	void *a = pool_alloc(&pool);
+
+	pool_free(&pool, a);
+	cr_expect(pool.free_list == a, "freed object should be on the free list");
+	cr_expect(pool_alloc(&pool) == a, "freed object should be handed out again");
+	cr_expect(pool.free_list == NULL, "free list should be empty again");
+}
+
+Test(pool_tests, pooled_list)
+{
+	List list;
+	int items[3] = { 1, 2, 3 };
+	void *removed;
+
+	list_init_pool(&list, NULL, &pool);
+
+	cr_expect(list_insert_next(&list, NULL, &items[0]) == 0, "insert into empty list should return 0");
+	cr_expect(list_insert_next(&list, list_tail(&list), &items[1]) == 0, "insert at tail should return 0");
+	cr_expect(list_insert_next(&list, list_tail(&list), &items[2]) == 0, "insert at tail should return 0");
+	cr_expect(list_size(&list) == 3, "list's size should be 3");
+
+	cr_expect(list_remove_next(&list, list_head(&list), &removed) == 0, "remove after head should return 0");
+	cr_expect(removed == &items[1], "removed item should be the second item inserted");
+	cr_expect(pool.free_list != NULL, "removed element should be returned to the pool");
+
+	cr_expect(list_insert_next(&list, NULL, &items[1]) == 0, "insert at head should return 0");
+	cr_expect(pool.free_list == NULL, "recycled element should be reused");
+	cr_expect(list_data(list_head(&list)) == &items[1], "head should be the item reinserted");
+
+	list_destroy(&list);
+}
+
+Test(pool_tests, pooled_stack_and_queue)
+{
+	Stack stack;
+	Queue queue;
+	int items[2] = { 1, 2 };
+	void *removed;
+
+	stack_init_pool(&stack, NULL, &pool);
+	queue_init_pool(&queue, NULL, &pool);
+
+	cr_expect(stack_push(&stack, &items[0]) == 0, "push should return 0");
+	cr_expect(stack_push(&stack, &items[1]) == 0, "push should return 0");
+	cr_expect(queue_enqueue(&queue, &items[0]) == 0, "enqueue should return 0");
+	cr_expect(queue_enqueue(&queue, &items[1]) == 0, "enqueue should return 0");
+
+	cr_expect(stack_pop(&stack, &removed) == 0 && removed == &items[1], "pop should return last pushed");
+	cr_expect(queue_dequeue(&queue, &removed) == 0 && removed == &items[0], "dequeue should return first enqueued");
+
+	stack_destroy(&stack);
+	queue_destroy(&queue);
+}
+
+static int destroyed;
+
+static void
+count_destroy(void *data)
+{
+	destroyed++;
+}
+
+Test(pool_tests, arena_allocator)
+{
+	Allocator arena;
+
+	cr_expect(pool_arena_allocator(&arena, sizeof (List_Element), 2, 0) == 0, "arena creation should return 0");
+	cr_expect(arena.release != NULL, "arena allocator should have a release function");
+	cr_expect(allocator_alloc(&arena, sizeof (List_Element)) != NULL, "alloc from arena should succeed");
+	cr_expect(allocator_alloc(&arena, sizeof (List_Element) + 1) == NULL, "oversized alloc should fail");
+
+	arena.release(arena.context);
+}
+
+Test(pool_tests, arena_list_teardown)
+{
+	List list;
+	int items[3] = { 1, 2, 3 };
+	int i;
+
+	destroyed = 0;
+	cr_expect(list_init_arena(&list, count_destroy, 2) == 0, "arena list init should return 0");
+
+	for (i = 0; i < 3; i++) {
+		cr_expect(list_insert_next(&list, NULL, &items[i]) == 0, "insert should return 0");
+	}
+
+	list_destroy(&list);
+	cr_expect(destroyed == 3, "destroy should be called once per element");
+	cr_expect(list_size(&list) == 0 && list_head(&list) == NULL, "destroyed list should be cleared");
+}
+
+Test(pool_tests, arena_dlist_teardown)
+{
+	DList list;
+	int items[3] = { 1, 2, 3 };
+	void *removed;
+	int i;
+
+	destroyed = 0;
+	cr_expect(dlist_init_arena(&list, count_destroy, 0) == 0, "arena list init should return 0");
+
+	cr_expect(dlist_insert_next(&list, NULL, &items[0]) == 0, "insert into empty list should return 0");
+
+	for (i = 1; i < 3; i++) {
+		cr_expect(dlist_insert_next(&list, dlist_tail(&list), &items[i]) == 0, "insert should return 0");
+	}
+
+	cr_expect(dlist_remove(&list, dlist_head(&list), &removed) == 0, "remove should return 0");
+
+	dlist_destroy(&list);
+	cr_expect(destroyed == 2, "destroy should be called once per remaining element");
+}
+
+Test(pool_tests, arena_clist_teardown)
+{
+	CList list;
+	int items[3] = { 1, 2, 3 };
+	int i;
+
+	destroyed = 0;
+	cr_expect(clist_init_arena(&list, count_destroy, 0) == 0, "arena list init should return 0");
+
+	for (i = 0; i < 3; i++) {
+		cr_expect(clist_insert_next(&list, clist_head(&list), &items[i]) == 0, "insert should return 0");
+	}
+
+	clist_destroy(&list);
+	cr_expect(destroyed == 3, "destroy should be called once per element");
+}
+
+Test(pool_tests, hugepage_pool)
+{
+	Pool huge;
+	char *a, *b;
+
+	pool_init_flags(&huge, sizeof (DList_Element), 0, POOL_HUGEPAGE);
+	cr_expect(sizeof (Pool_Slab) + huge.object_size * huge.slab_count <= POOL_HUGEPAGE_SIZE,
+	          "slab should fit in a huge page");
+	cr_expect(huge.slab_count > POOL_HUGEPAGE_SIZE / huge.object_size - 2, "slab should fill a huge page");
+
+	a = pool_alloc(&huge);
+	b = pool_alloc(&huge);
+	cr_expect(a != NULL && b != NULL, "alloc from huge page pool should succeed");
+	cr_expect(b - a == (long)huge.object_size, "objects should be adjacent in a slab");
+	cr_expect(huge.slabs->mapped == 0 || ((size_t)huge.slabs & (POOL_HUGEPAGE_SIZE - 1)) == 0,
+	          "mapped slab should be huge page aligned");
+
+	// Touch the whole slab to make sure the mapping is usable
+	memset(a, 0xff, huge.object_size * huge.slab_count);
+
+	pool_destroy(&huge);
+}
+
+Test(pool_tests, hugepage_dlist)
+{
+	DList list;
+	long i;
+
+	destroyed = 0;
+	cr_expect(dlist_init_hugepage(&list, count_destroy) == 0, "huge page list init should return 0");
+	cr_expect(dlist_insert_next(&list, NULL, NULL) == 0, "insert into empty list should return 0");
+
+	for (i = 1; i < 100000; i++) {
+		cr_expect(dlist_insert_next(&list, dlist_tail(&list), (void *)i) == 0, "insert should return 0");
+	}
+
+	cr_expect(dlist_data(dlist_prev(dlist_tail(&list))) == (void *)99998, "tail links should be intact");
+
+	dlist_destroy(&list);
+	cr_expect(destroyed == 100000, "destroy should be called once per element");
+}
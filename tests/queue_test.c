@@ -92,3 +92,25 @@ Test(queue_tests, queue_enqueue_peek_dequeue)
 	cr_expect(item3 == removed, "dequeued item should be third item enqueueed");
 }
 
+
+Test(queue_tests, queue_enqueue_dequeue_n)
+{
+	void *batch[3] = { item1, item2, item3 };
+	void *removed[3] = { NULL, NULL, NULL };
+
+	cr_expect(queue_enqueue_n(&queue, batch, 3) == 0, "batch enqueue should return 0");
+	cr_expect(queue_size(&queue) == 3, "queue should have a size of 3");
+	cr_expect(queue_peek(&queue) == item1, "front of queue should be first item of the batch");
+
+	cr_expect(queue_dequeue_n(&queue, removed, 2) == 2, "batch dequeue should return 2");
+	cr_expect(removed[0] == item1 && removed[1] == item2, "dequeued items should be in batch order");
+	cr_expect(queue_size(&queue) == 1, "queue should have a size of 1");
+
+	cr_expect(queue_dequeue_n(&queue, removed, 3) == 1, "batch dequeue should stop when queue is empty");
+	cr_expect(removed[0] == item3, "dequeued item should be third item of the batch");
+	cr_expect(queue_dequeue_n(&queue, removed, 3) == 0, "batch dequeue from empty queue should return 0");
+
+	free(item1);
+	free(item2);
+	free(item3);
+}
@@ -0,0 +1,111 @@
+/**
+ * \file rqueue_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for ring-buffer Queue ADT
+ */
+#include <criterion/criterion.h>
+
+#include <stdlib.h> // free()
+
+#include "../src/rqueue.h"
+
+RQueue queue;
+
+int items[3] = { 1, 2, 3 };
+
+void
+suite_setup()
+{
+	rqueue_init(&queue, NULL);
+}
+
+void
+suite_teardown()
+{
+	rqueue_destroy(&queue);
+}
+
+TestSuite(rqueue_tests, .init=suite_setup, .fini=suite_teardown);
+
+Test(rqueue_tests, empty)
+{
+	void *dequeued;
+
+	cr_expect(rqueue_size(&queue) == 0, "empty queue's size should be 0");
+	cr_expect(rqueue_peek(&queue) == NULL, "empty queue's peek should be NULL");
+	cr_expect(rqueue_dequeue(&queue, &dequeued) == -1, "dequeue from empty queue should return -1");
+}
+
+Test(rqueue_tests, enqueue_peek_dequeue)
+{
+	void *dequeued;
+	int i;
+
+	for (i = 0; i < 3; i++) {
+		cr_expect(rqueue_enqueue(&queue, &items[i]) == 0, "enqueue should return 0");
+		cr_expect(rqueue_size(&queue) == i + 1, "queue's size should be %d", i + 1);
+		cr_expect(rqueue_peek(&queue) == &items[0], "front of queue should be first item enqueued");
+	}
+
+	for (i = 0; i < 3; i++) {
+		cr_expect(rqueue_dequeue(&queue, &dequeued) == 0, "dequeue should return 0");
+		cr_expect(dequeued == &items[i], "dequeue should return items in order");
+	}
+
+	cr_expect(rqueue_size(&queue) == 0, "queue should be empty again");
+}
+
+Test(rqueue_tests, grow_while_wrapped)
+{
+	void *dequeued;
+	long i, next = 0;
+
+	// Move the front of the queue into the middle of the buffer, then fill it so it wraps
+	for (i = 0; i < RQUEUE_DEFAULT_CAPACITY / 2; i++) {
+		rqueue_enqueue(&queue, (void *)i);
+		rqueue_dequeue(&queue, &dequeued);
+	}
+
+	for (i = 0; i < RQUEUE_DEFAULT_CAPACITY; i++) {
+		rqueue_enqueue(&queue, (void *)i);
+	}
+
+	cr_expect(rqueue_capacity(&queue) == RQUEUE_DEFAULT_CAPACITY, "queue should be exactly full");
+
+	// Growing must keep the wrapped elements in order
+	for (; i < 3 * RQUEUE_DEFAULT_CAPACITY; i++) {
+		cr_expect(rqueue_enqueue(&queue, (void *)i) == 0, "enqueue should return 0");
+	}
+
+	cr_expect(rqueue_capacity(&queue) == 4 * RQUEUE_DEFAULT_CAPACITY, "buffer should have doubled twice");
+
+	while (rqueue_dequeue(&queue, &dequeued) == 0) {
+		cr_expect(dequeued == (void *)next, "dequeue should return %ld", next);
+		next++;
+	}
+
+	cr_expect(next == 3 * RQUEUE_DEFAULT_CAPACITY, "every element should be dequeued");
+}
+
+Test(rqueue_tests, reserve)
+{
+	cr_expect(rqueue_reserve(&queue, 100) == 0, "reserve should return 0");
+	cr_expect(rqueue_capacity(&queue) == 128, "capacity should round up to a power of two");
+	cr_expect(rqueue_reserve(&queue, 10) == 0, "smaller reserve should return 0");
+	cr_expect(rqueue_capacity(&queue) == 128, "reserve should not shrink the buffer");
+}
+
+Test(rqueue_tests, destroy_data)
+{
+	RQueue owned;
+	int i;
+
+	rqueue_init(&owned, free);
+
+	for (i = 0; i < 3; i++) {
+		rqueue_enqueue(&owned, malloc(sizeof (int)));
+	}
+
+	rqueue_destroy(&owned);
+	cr_expect(rqueue_size(&owned) == 0 && owned.data == NULL, "destroyed queue should be cleared");
+}
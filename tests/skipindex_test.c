@@ -0,0 +1,184 @@
+/**
+ * \file skipindex_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for SkipIndex
+ */
+#include <criterion/criterion.h>
+
+#include <stdlib.h> // rand()
+
+#include "../src/skipindex.h"
+
+#define ELEMENT_COUNT 4000
+
+DList list;
+SkipIndex skip;
+
+static int
+compare_keys(const void *key1, const void *key2)
+{
+	long a = (long)key1, b = (long)key2;
+
+	return (a > b) - (a < b);
+}
+
+// Check order and both directions of links, and that the index finds every element
+static void
+expect_consistent(int size)
+{
+	DList_Element *element, *previous = NULL;
+	int count = 0;
+
+	for (element = dlist_head(&list); element != NULL; element = dlist_next(element)) {
+		cr_assert(dlist_prev(element) == previous, "prev link should be intact");
+
+		if (previous != NULL) {
+			cr_assert(compare_keys(dlist_data(previous), dlist_data(element)) <= 0,
+			          "list should stay sorted");
+		}
+
+		cr_assert(compare_keys(dlist_data(skipindex_search(&skip, dlist_data(element))),
+		                       dlist_data(element)) == 0, "index should find every element");
+
+		previous = element;
+		count++;
+	}
+
+	cr_assert(dlist_tail(&list) == previous, "tail should be the last element");
+	cr_assert(count == size && dlist_size(&list) == size, "size should be %d", size);
+}
+
+void
+suite_setup()
+{
+	dlist_init(&list, NULL);
+}
+
+void
+suite_teardown()
+{
+	skipindex_destroy(&skip);
+	dlist_destroy(&list);
+}
+
+TestSuite(skipindex_tests, .init=suite_setup, .fini=suite_teardown);
+
+Test(skipindex_tests, empty)
+{
+	void *data;
+
+	cr_assert(skipindex_init(&skip, &list, compare_keys) == 0, "init should succeed");
+	cr_expect(skipindex_list(&skip) == &list, "index should refer to the list");
+	cr_expect(skipindex_search(&skip, (void *)1L) == NULL, "search of empty list should fail");
+	cr_expect(skipindex_lower_bound(&skip, (void *)1L) == NULL,
+	          "lower bound in empty list should be NULL");
+	cr_expect(skipindex_remove(&skip, NULL, &data) == -1, "remove from empty list should fail");
+}
+
+Test(skipindex_tests, build_and_search)
+{
+	DList_Element *element;
+	long i;
+
+	// Even keys 0, 2, ..., 2 * (ELEMENT_COUNT - 1)
+	for (i = 0; i < ELEMENT_COUNT; i++) {
+		dlist_insert_next(&list, dlist_tail(&list), (void *)(2 * i));
+	}
+
+	cr_assert(skipindex_init(&skip, &list, compare_keys) == 0, "init should succeed");
+
+	for (i = 0; i < ELEMENT_COUNT; i++) {
+		element = skipindex_search(&skip, (void *)(2 * i));
+		cr_assert(element != NULL && dlist_data(element) == (void *)(2 * i), "%ld should be found",
+		          2 * i);
+		cr_assert(skipindex_search(&skip, (void *)(2 * i + 1)) == NULL, "%ld should be missing",
+		          2 * i + 1);
+
+		element = skipindex_lower_bound(&skip, (void *)(2 * i - 1));
+		cr_assert(element != NULL && dlist_data(element) == (void *)(2 * i),
+		          "lower bound of %ld should be %ld", 2 * i - 1, 2 * i);
+	}
+
+	cr_expect(skipindex_lower_bound(&skip, (void *)(2L * ELEMENT_COUNT)) == NULL,
+	          "lower bound past the last key should be NULL");
+	expect_consistent(ELEMENT_COUNT);
+}
+
+Test(skipindex_tests, sorted_insert)
+{
+	DList_Element *element;
+	long key;
+	int i;
+
+	cr_assert(skipindex_init(&skip, &list, compare_keys) == 0, "init should succeed");
+	srand(1);
+
+	for (i = 0; i < ELEMENT_COUNT; i++) {
+		key = rand() % (ELEMENT_COUNT / 4);
+		cr_assert(skipindex_insert(&skip, (void *)key) == 0, "insert should succeed");
+	}
+
+	expect_consistent(ELEMENT_COUNT);
+
+	// Inserting below the head and above the tail
+	cr_assert(skipindex_insert(&skip, (void *)-1L) == 0, "insert at head should succeed");
+	cr_assert(skipindex_insert(&skip, (void *)(long)ELEMENT_COUNT) == 0,
+	          "insert at tail should succeed");
+	cr_expect(dlist_data(dlist_head(&list)) == (void *)-1L, "head should be the smallest key");
+	cr_expect(dlist_data(dlist_tail(&list)) == (void *)(long)ELEMENT_COUNT,
+	          "tail should be the largest key");
+
+	// Search returns the first of equal keys
+	element = skipindex_search(&skip, dlist_data(dlist_tail(&list)));
+	cr_expect(element == dlist_tail(&list), "search should find the tail");
+
+	for (element = dlist_head(&list); element != NULL; element = dlist_next(element)) {
+		if (dlist_prev(element) == NULL || dlist_data(dlist_prev(element)) != dlist_data(element)) {
+			cr_assert(skipindex_search(&skip, dlist_data(element)) == element,
+			          "search should find the first of equal keys");
+		}
+	}
+
+	expect_consistent(ELEMENT_COUNT + 2);
+}
+
+Test(skipindex_tests, remove)
+{
+	DList_Element *element, *next;
+	void *data;
+	long i;
+	int size = ELEMENT_COUNT;
+
+	for (i = 0; i < ELEMENT_COUNT; i++) {
+		dlist_insert_next(&list, dlist_tail(&list), (void *)(i / 3));
+	}
+
+	cr_assert(skipindex_init(&skip, &list, compare_keys) == 0, "init should succeed");
+
+	// Remove every other element, including ones carrying towers
+	for (element = dlist_head(&list); element != NULL; element = next) {
+		next = dlist_next(element);
+
+		if (next != NULL) {
+			next = dlist_next(next);
+		}
+
+		cr_assert(skipindex_remove(&skip, element, &data) == 0, "remove should succeed");
+		size--;
+	}
+
+	expect_consistent(size);
+
+	// Empty it entirely through the index, then refill
+	while (dlist_size(&list) > 0) {
+		cr_assert(skipindex_remove(&skip, dlist_tail(&list), &data) == 0, "remove should succeed");
+	}
+
+	cr_expect(skip.level == 0, "empty index should have no levels in use");
+
+	for (i = 0; i < 100; i++) {
+		cr_assert(skipindex_insert(&skip, (void *)(99 - i)) == 0, "insert should succeed");
+	}
+
+	expect_consistent(100);
+}
@@ -0,0 +1,146 @@
+/**
+ * \file spscqueue_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for single-producer/single-consumer Queue
+ */
+#include <criterion/criterion.h>
+
+#include <pthread.h>
+#include <sched.h>  // sched_yield()
+#include <stdlib.h> // free()
+
+#include "../src/spscqueue.h"
+
+#define TRANSFER_COUNT 1000000L
+
+SPSCQueue queue;
+
+int items[4] = { 1, 2, 3, 4 };
+
+void
+suite_setup()
+{
+	spscqueue_init(&queue, NULL, 3);
+}
+
+void
+suite_teardown()
+{
+	spscqueue_destroy(&queue);
+}
+
+TestSuite(spscqueue_tests, .init=suite_setup, .fini=suite_teardown);
+
+Test(spscqueue_tests, empty)
+{
+	void *dequeued;
+
+	cr_expect(spscqueue_capacity(&queue) == 4, "capacity should round up to a power of two");
+	cr_expect(spscqueue_size(&queue) == 0, "empty queue's size should be 0");
+	cr_expect(spscqueue_dequeue(&queue, &dequeued) == -1, "dequeue from empty queue should return -1");
+}
+
+Test(spscqueue_tests, fill_and_drain)
+{
+	void *dequeued;
+	int round, i;
+
+	// Several rounds so the indices wrap around the ring
+	for (round = 0; round < 3; round++) {
+		for (i = 0; i < 4; i++) {
+			cr_expect(spscqueue_enqueue(&queue, &items[i]) == 0, "enqueue should return 0");
+		}
+
+		cr_expect(spscqueue_enqueue(&queue, &items[0]) == -1, "enqueue onto full queue should return -1");
+		cr_expect(spscqueue_size(&queue) == 4, "queue's size should be 4");
+
+		for (i = 0; i < 4; i++) {
+			cr_expect(spscqueue_dequeue(&queue, &dequeued) == 0, "dequeue should return 0");
+			cr_expect(dequeued == &items[i], "dequeue should return items in order");
+		}
+
+		cr_expect(spscqueue_dequeue(&queue, &dequeued) == -1, "dequeue from drained queue should return -1");
+	}
+}
+
+static void *
+producer_run(void *arg)
+{
+	long i;
+
+	for (i = 1; i <= TRANSFER_COUNT; i++) {
+		while (spscqueue_enqueue(&queue, (void *)i) != 0) {
+			sched_yield();
+		}
+	}
+
+	return NULL;
+}
+
+Test(spscqueue_tests, two_threads)
+{
+	pthread_t producer;
+	void *dequeued;
+	long expected = 1;
+
+	pthread_create(&producer, NULL, producer_run, NULL);
+
+	while (expected <= TRANSFER_COUNT) {
+		if (spscqueue_dequeue(&queue, &dequeued) != 0) {
+			sched_yield();
+			continue;
+		}
+
+		if (dequeued != (void *)expected) {
+			break;
+		}
+
+		expected++;
+	}
+
+	pthread_join(producer, NULL);
+	cr_expect(expected == TRANSFER_COUNT + 1, "every item should arrive once and in order");
+}
+
+Test(spscqueue_tests, destroy_data)
+{
+	SPSCQueue owned;
+	int i;
+
+	spscqueue_init(&owned, free, 8);
+
+	for (i = 0; i < 3; i++) {
+		spscqueue_enqueue(&owned, malloc(sizeof (int)));
+	}
+
+	spscqueue_destroy(&owned);
+	cr_expect(owned.data == NULL, "destroyed queue should be cleared");
+}
+
+Test(spscqueue_tests, batch)
+{
+	void *batch[4] = { &items[0], &items[1], &items[2], &items[3] };
+	void *dequeued[4];
+	int round, i;
+
+	// Several rounds so the batches wrap around the end of the ring
+	for (round = 0; round < 3; round++) {
+		cr_expect(spscqueue_enqueue(&queue, batch[0]) == 0, "enqueue should return 0");
+		cr_expect(spscqueue_enqueue_n(&queue, &batch[1], 4) == 3, "batch enqueue should stop when full");
+		cr_expect(spscqueue_enqueue_n(&queue, batch, 1) == 0, "batch enqueue onto full queue should return 0");
+
+		cr_expect(spscqueue_dequeue_n(&queue, dequeued, 3) == 3, "batch dequeue should return 3");
+		cr_expect(spscqueue_dequeue_n(&queue, &dequeued[3], 4) == 1, "batch dequeue should stop when empty");
+
+		for (i = 0; i < 4; i++) {
+			cr_expect(dequeued[i] == batch[i], "dequeued items should be in order");
+		}
+	}
+
+	// A negative count must not reach past the caller's array
+	cr_expect(spscqueue_enqueue_n(&queue, batch, -1) == 0, "batch enqueue of -1 elements should return 0");
+	cr_expect(spscqueue_size(&queue) == 0, "queue should still be empty");
+	spscqueue_enqueue(&queue, batch[0]);
+	cr_expect(spscqueue_dequeue_n(&queue, dequeued, -1) == 0, "batch dequeue of -1 elements should return 0");
+	cr_expect(spscqueue_size(&queue) == 1, "queue should still hold 1 element");
+}
@@ -87,3 +87,22 @@ Test(stack_tests, stack_push_peek_pop)
 	cr_expect(stack_size(&stack) == 0, "stack should have a size of 0");
 	cr_expect(item1 == removed, "popped item should be first item pushed");
 }
+
+Test(stack_tests, stack_push_pop_n)
+{
+	void *batch[3] = { item1, item2, item3 };
+	void *removed[3] = { NULL, NULL, NULL };
+
+	cr_expect(stack_push_n(&stack, batch, 3) == 0, "batch push should return 0");
+	cr_expect(stack_size(&stack) == 3, "stack should have a size of 3");
+	cr_expect(stack_peek(&stack) == item1, "top of stack should be first item of the batch");
+
+	cr_expect(stack_pop_n(&stack, removed, 3) == 3, "batch pop should return 3");
+	cr_expect(removed[0] == item1 && removed[1] == item2 && removed[2] == item3,
+	          "popped batch should match pushed batch");
+	cr_expect(stack_pop_n(&stack, removed, 3) == 0, "batch pop from empty stack should return 0");
+
+	free(item1);
+	free(item2);
+	free(item3);
+}
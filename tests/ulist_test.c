@@ -0,0 +1,183 @@
+/**
+ * \file ulist_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for Unrolled linked-list ADT
+ */
+#include <criterion/criterion.h>
+
+#include "../src/ulist.h"
+
+#define COUNT 100
+
+UList list;
+
+int items[COUNT];
+
+void
+suite_setup()
+{
+	int i;
+
+	for (i = 0; i < COUNT; i++) {
+		items[i] = i;
+	}
+
+	ulist_init(&list, NULL);
+}
+
+void
+suite_teardown()
+{
+	ulist_destroy(&list);
+}
+
+TestSuite(ulist_tests, .init=suite_setup, .fini=suite_teardown);
+
+// Checks that the list holds exactly `expected`, in order
+static void
+expect_contents(const int *expected, int count)
+{
+	UList_Iter iter;
+	int i = 0;
+
+	cr_expect(ulist_size(&list) == count, "list's size should be %d", count);
+
+	if (ulist_iter_head(&list, &iter) != 0) {
+		cr_expect(count == 0, "only an empty list should have no head");
+		return;
+	}
+
+	do {
+		cr_assert(i < count, "list should not hold more than its size");
+		cr_expect(*(int *)ulist_data(&iter) == expected[i], "element %d should be %d", i, expected[i]);
+		i++;
+	} while (ulist_iter_next(&iter) == 0);
+
+	cr_expect(i == count, "iteration should visit every element");
+}
+
+Test(ulist_tests, empty)
+{
+	UList_Iter iter;
+	void *removed;
+
+	cr_expect(ulist_size(&list) == 0, "empty list's size should be 0");
+	cr_expect(ulist_iter_head(&list, &iter) == -1, "empty list should have no head");
+	cr_expect(ulist_iter_tail(&list, &iter) == -1, "empty list should have no tail");
+	cr_expect(ulist_remove_next(&list, NULL, &removed) == -1, "remove from empty list should return -1");
+}
+
+Test(ulist_tests, append_many)
+{
+	UList_Iter iter;
+	int i;
+
+	for (i = 0; i < COUNT; i++) {
+		ulist_iter_tail(&list, &iter);
+		cr_expect(ulist_insert_next(&list, i == 0 ? NULL : &iter, &items[i]) == 0, "append should return 0");
+	}
+
+	expect_contents(items, COUNT);
+
+	ulist_iter_tail(&list, &iter);
+	cr_expect(ulist_is_tail(&iter) == 1, "tail iterator should be at the tail");
+	cr_expect(*(int *)ulist_data(&iter) == COUNT - 1, "tail should be the last item appended");
+
+	// Appends fill each node before starting the next
+	cr_expect(list.head->count == ULIST_NODE_CAPACITY, "head node should be full");
+}
+
+Test(ulist_tests, prepend_many)
+{
+	int expected[COUNT];
+	int i;
+
+	for (i = 0; i < COUNT; i++) {
+		cr_expect(ulist_insert_next(&list, NULL, &items[i]) == 0, "insert at head should return 0");
+		expected[COUNT - 1 - i] = i;
+	}
+
+	expect_contents(expected, COUNT);
+}
+
+Test(ulist_tests, insert_splits_full_node)
+{
+	int expected[ULIST_NODE_CAPACITY + 1];
+	UList_Iter iter;
+	int i, j;
+
+	for (i = 0; i < ULIST_NODE_CAPACITY; i++) {
+		ulist_iter_tail(&list, &iter);
+		ulist_insert_next(&list, i == 0 ? NULL : &iter, &items[i]);
+	}
+
+	// Insert after the third element of the full node
+	ulist_iter_head(&list, &iter);
+	ulist_iter_next(&iter);
+	ulist_iter_next(&iter);
+	cr_expect(ulist_insert_next(&list, &iter, &items[COUNT - 1]) == 0, "insert into full node should return 0");
+
+	for (i = 0, j = 0; i < ULIST_NODE_CAPACITY; i++) {
+		expected[j++] = i;
+
+		if (i == 2) {
+			expected[j++] = COUNT - 1;
+		}
+	}
+
+	expect_contents(expected, ULIST_NODE_CAPACITY + 1);
+	cr_expect(list.head->next != NULL, "full node should have been split");
+}
+
+Test(ulist_tests, remove_as_queue)
+{
+	UList_Iter iter;
+	void *removed;
+	int i;
+
+	for (i = 0; i < COUNT; i++) {
+		ulist_iter_tail(&list, &iter);
+		ulist_insert_next(&list, i == 0 ? NULL : &iter, &items[i]);
+	}
+
+	for (i = 0; i < COUNT; i++) {
+		cr_expect(ulist_remove_next(&list, NULL, &removed) == 0, "remove at head should return 0");
+		cr_expect(removed == &items[i], "elements should come out in order");
+	}
+
+	cr_expect(ulist_size(&list) == 0, "list's size should be 0");
+	cr_expect(list.head == NULL && list.tail == NULL, "empty list should have no nodes");
+}
+
+Test(ulist_tests, remove_after_iter)
+{
+	int expected[COUNT / 2];
+	UList_Iter iter;
+	void *removed;
+	int i, j;
+
+	for (i = 0; i < COUNT; i++) {
+		ulist_iter_tail(&list, &iter);
+		ulist_insert_next(&list, i == 0 ? NULL : &iter, &items[i]);
+	}
+
+	// Remove every odd element
+	ulist_iter_head(&list, &iter);
+
+	for (i = 0; i < COUNT / 2; i++) {
+		cr_expect(ulist_remove_next(&list, &iter, &removed) == 0, "remove after element should return 0");
+		cr_expect(removed == &items[2 * i + 1], "removed element should be the odd one");
+		expected[i] = 2 * i;
+
+		if (i + 1 < COUNT / 2) {
+			ulist_iter_head(&list, &iter);
+
+			for (j = 0; j <= i; j++) {
+				ulist_iter_next(&iter);
+			}
+		}
+	}
+
+	cr_expect(ulist_remove_next(&list, &iter, &removed) == -1, "remove after tail should return -1");
+	expect_contents(expected, COUNT / 2);
+}
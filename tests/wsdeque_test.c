@@ -0,0 +1,154 @@
+/**
+ * \file wsdeque_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for WSDeque
+ */
+#include <criterion/criterion.h>
+
+#include <pthread.h>
+#include <stdlib.h> // free()
+
+#include "../src/wsdeque.h"
+
+#define THIEF_COUNT 3
+#define TRANSFER_COUNT 200000L
+
+WSDeque deque;
+
+int items[3] = { 1, 2, 3 };
+
+void
+suite_setup()
+{
+	wsdeque_init(&deque, NULL, 2);
+}
+
+void
+suite_teardown()
+{
+	wsdeque_destroy(&deque);
+}
+
+TestSuite(wsdeque_tests, .init=suite_setup, .fini=suite_teardown);
+
+Test(wsdeque_tests, empty)
+{
+	void *data;
+
+	cr_expect(wsdeque_capacity(&deque) == 2, "capacity should be 2");
+	cr_expect(wsdeque_size(&deque) == 0, "empty deque's size should be 0");
+	cr_expect(wsdeque_pop(&deque, &data) == -1, "pop from empty deque should return -1");
+	cr_expect(wsdeque_steal(&deque, &data) == -1, "steal from empty deque should return -1");
+	cr_expect(wsdeque_size(&deque) == 0, "failed pop should leave the deque empty");
+}
+
+Test(wsdeque_tests, pop_and_steal_order)
+{
+	void *data;
+	int i;
+
+	for (i = 0; i < 3; i++) {
+		cr_expect(wsdeque_push(&deque, &items[i]) == 0, "push should return 0");
+	}
+
+	cr_expect(wsdeque_capacity(&deque) == 4, "ring should have doubled");
+	cr_expect(wsdeque_size(&deque) == 3, "deque's size should be 3");
+
+	cr_expect(wsdeque_steal(&deque, &data) == 0 && data == &items[0], "steal should take the oldest item");
+	cr_expect(wsdeque_pop(&deque, &data) == 0 && data == &items[2], "pop should take the newest item");
+	cr_expect(wsdeque_pop(&deque, &data) == 0 && data == &items[1], "pop should take the last item");
+	cr_expect(wsdeque_pop(&deque, &data) == -1, "pop from drained deque should return -1");
+}
+
+Test(wsdeque_tests, grow_keeps_elements)
+{
+	void *data;
+	long i;
+
+	// Interleave pops so the live range wraps around the ring when it grows
+	for (i = 1; i <= 1000; i++) {
+		cr_expect(wsdeque_push(&deque, (void *)i) == 0, "push should return 0");
+
+		if (i % 3 == 0) {
+			cr_expect(wsdeque_steal(&deque, &data) == 0, "steal should return 0");
+		}
+	}
+
+	cr_expect(wsdeque_size(&deque) == 667, "deque's size should be 667");
+	cr_expect(wsdeque_steal(&deque, &data) == 0 && data == (void *)334L, "elements should survive growth in order");
+	cr_expect(wsdeque_pop(&deque, &data) == 0 && data == (void *)1000L, "newest element should be at the bottom");
+}
+
+static atomic_long stolen_sum;
+
+static void *
+thief_run(void *arg)
+{
+	atomic_int *done = (atomic_int *)arg;
+	long sum = 0;
+	void *data;
+
+	// Keep stealing until the owner is done and the deque is drained
+	while (!atomic_load(done) || wsdeque_size(&deque) > 0) {
+		if (wsdeque_steal(&deque, &data) == 0) {
+			sum += (long)data;
+		}
+	}
+
+	atomic_fetch_add(&stolen_sum, sum);
+
+	return NULL;
+}
+
+Test(wsdeque_tests, owner_and_thieves)
+{
+	pthread_t thieves[THIEF_COUNT];
+	atomic_int done = 0;
+	long sum = 0, n = TRANSFER_COUNT;
+	void *data;
+	long i;
+
+	atomic_store(&stolen_sum, 0);
+
+	for (i = 0; i < THIEF_COUNT; i++) {
+		pthread_create(&thieves[i], NULL, thief_run, &done);
+	}
+
+	// The owner pushes everything, popping some of it back itself along the way
+	for (i = 1; i <= n; i++) {
+		wsdeque_push(&deque, (void *)i);
+
+		if (i % 2 == 0 && wsdeque_pop(&deque, &data) == 0) {
+			sum += (long)data;
+		}
+	}
+
+	while (wsdeque_pop(&deque, &data) == 0) {
+		sum += (long)data;
+	}
+
+	atomic_store(&done, 1);
+
+	for (i = 0; i < THIEF_COUNT; i++) {
+		pthread_join(thieves[i], NULL);
+	}
+
+	cr_expect(sum + atomic_load(&stolen_sum) == n * (n + 1) / 2, "every item should be taken exactly once");
+	cr_expect(wsdeque_size(&deque) == 0, "deque should be empty");
+}
+
+Test(wsdeque_tests, destroy_data)
+{
+	WSDeque owned;
+	int i;
+
+	cr_expect(wsdeque_init(&owned, free, 0) == 0, "init should return 0");
+	cr_expect(wsdeque_capacity(&owned) == WS_DEQUE_DEFAULT_CAPACITY, "capacity should default");
+
+	for (i = 0; i < 100; i++) {
+		wsdeque_push(&owned, malloc(sizeof (int)));
+	}
+
+	wsdeque_destroy(&owned);
+	cr_expect(atomic_load(&owned.array) == NULL, "destroyed deque should be cleared");
+}
@@ -0,0 +1,153 @@
+/**
+ * \file xlist_test.c
+ * \author Justin Hadella (justin.hadella@gmail.com)
+ * \brief Unit test for XOR-linked list ADT
+ */
+#include <criterion/criterion.h>
+
+#include "../src/xlist.h"
+
+XList list;
+
+int items[5] = { 0, 1, 2, 3, 4 };
+
+void
+suite_setup()
+{
+	xlist_init(&list, NULL);
+}
+
+void
+suite_teardown()
+{
+	xlist_destroy(&list);
+}
+
+TestSuite(xlist_tests, .init=suite_setup, .fini=suite_teardown);
+
+// Checks the list holds `expected` both walking forward from the head and back from the tail
+static void
+expect_contents(const int *expected, int count)
+{
+	XList_Cursor cursor;
+	int i;
+
+	cr_expect(xlist_size(&list) == count, "list's size should be %d", count);
+
+	if (count == 0) {
+		cr_expect(xlist_cursor_head(&list, &cursor) == -1, "empty list should have no head");
+		cr_expect(xlist_cursor_tail(&list, &cursor) == -1, "empty list should have no tail");
+		return;
+	}
+
+	cr_assert(xlist_cursor_head(&list, &cursor) == 0, "list should have a head");
+	cr_expect(xlist_is_head(&cursor) == 1, "head cursor should be at the head");
+
+	for (i = 0; i < count; i++) {
+		cr_expect(*(int *)xlist_data(&cursor) == expected[i], "forward element %d should be %d", i, expected[i]);
+		cr_expect(xlist_next(&cursor) == (i + 1 < count ? 0 : -1), "next should stop at the tail");
+	}
+
+	cr_assert(xlist_cursor_tail(&list, &cursor) == 0, "list should have a tail");
+	cr_expect(xlist_is_tail(&cursor) == 1, "tail cursor should be at the tail");
+
+	for (i = count - 1; i >= 0; i--) {
+		cr_expect(*(int *)xlist_data(&cursor) == expected[i], "backward element %d should be %d", i, expected[i]);
+		cr_expect(xlist_prev(&cursor) == (i > 0 ? 0 : -1), "prev should stop at the head");
+	}
+}
+
+Test(xlist_tests, empty)
+{
+	XList_Cursor cursor = { NULL, NULL };
+	void *removed;
+
+	expect_contents(NULL, 0);
+	cr_expect(xlist_remove(&list, &cursor, &removed) == -1, "remove from empty list should return -1");
+}
+
+Test(xlist_tests, insert)
+{
+	int expected[5] = { 0, 1, 2, 3, 4 };
+	XList_Cursor cursor;
+
+	cr_expect(xlist_insert_next(&list, NULL, &items[2]) == 0, "insert into empty list should return 0");
+	cr_expect(xlist_insert_next(&list, NULL, &items[3]) == -1, "NULL cursor into non-empty list should return -1");
+
+	xlist_cursor_head(&list, &cursor);
+	cr_expect(xlist_insert_prev(&list, &cursor, &items[0]) == 0, "insert before head should return 0");
+	cr_expect(xlist_insert_prev(&list, &cursor, &items[1]) == 0, "insert before element should return 0");
+	cr_expect(xlist_data(&cursor) == &items[2], "cursor should stay on its element");
+
+	xlist_cursor_tail(&list, &cursor);
+	cr_expect(xlist_insert_next(&list, &cursor, &items[4]) == 0, "insert after tail should return 0");
+	cr_expect(xlist_insert_next(&list, &cursor, &items[3]) == 0, "insert after element should return 0");
+
+	expect_contents(expected, 5);
+}
+
+Test(xlist_tests, remove)
+{
+	int expected[3] = { 1, 2, 3 };
+	XList_Cursor cursor;
+	void *removed;
+	int i;
+
+	xlist_insert_next(&list, NULL, &items[0]);
+	xlist_cursor_head(&list, &cursor);
+
+	for (i = 1; i < 5; i++) {
+		xlist_insert_next(&list, &cursor, &items[i]);
+		xlist_next(&cursor);
+	}
+
+	// Remove the tail, then the head
+	cr_expect(xlist_remove(&list, &cursor, &removed) == 0, "remove at tail should return 0");
+	cr_expect(removed == &items[4], "removed item should be the tail");
+	cr_expect(cursor.curr == NULL, "cursor should be past the end");
+
+	xlist_cursor_head(&list, &cursor);
+	cr_expect(xlist_remove(&list, &cursor, &removed) == 0, "remove at head should return 0");
+	cr_expect(removed == &items[0], "removed item should be the head");
+	cr_expect(xlist_data(&cursor) == &items[1], "cursor should move to the new head");
+
+	expect_contents(expected, 3);
+
+	// Remove from the middle
+	xlist_next(&cursor);
+	cr_expect(xlist_remove(&list, &cursor, &removed) == 0, "remove in between should return 0");
+	cr_expect(removed == &items[2], "removed item should be the middle one");
+	cr_expect(xlist_data(&cursor) == &items[3], "cursor should move to the next element");
+
+	expected[1] = 3;
+	expect_contents(expected, 2);
+}
+
+Test(xlist_tests, arena)
+{
+	int expected[4] = { 0, 1, 3, 4 };
+	XList_Cursor cursor;
+	void *removed;
+	int i;
+
+	// Swap the default list for an arena-backed one
+	xlist_destroy(&list);
+	cr_assert(xlist_init_arena(&list, NULL, 2) == 0, "arena init should return 0");
+	cr_expect(list.allocator.release != NULL, "arena list should be released in one shot");
+
+	xlist_insert_next(&list, NULL, &items[0]);
+	xlist_cursor_head(&list, &cursor);
+
+	for (i = 1; i < 5; i++) {
+		xlist_insert_next(&list, &cursor, &items[i]);
+		xlist_next(&cursor);
+	}
+
+	xlist_cursor_head(&list, &cursor);
+	xlist_next(&cursor);
+	xlist_next(&cursor);
+	cr_expect(xlist_remove(&list, &cursor, &removed) == 0, "remove should return 0");
+	cr_expect(removed == &items[2], "removed item should be the middle one");
+
+	expect_contents(expected, 4);
+}